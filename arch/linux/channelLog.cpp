@@ -0,0 +1,425 @@
+/*
+ * channelLog.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <schedulerUnitTest.h>
+#include "channelLog.h"
+
+namespace
+{
+/// Identification of a channel log file
+const uint32_t fileMagic = 0x54434c47u;
+
+/// Version of the layout of the log file
+const uint32_t fileVersion = 1u;
+
+/// Alignment of the segments, each segment starts in an own cache line
+const size_t segmentAlignment = 64u;
+
+/// Alignment of the records in a segment
+const size_t recordAlignment = 8u;
+
+/// @return Current time of CLOCK_MONOTONIC in nanoseconds
+uint64_t
+getMonotonicTime(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (static_cast<uint64_t>(now.tv_sec) * 1000000000u) + static_cast<uint64_t>(now.tv_nsec);
+}
+
+/// @return Size of a record with its padded data
+size_t
+getRecordSize(size_t dataSize)
+{
+    return sizeof(Tasking::ChannelLogRecord) + (((dataSize + recordAlignment) - 1u) & ~(recordAlignment - 1u));
+}
+} // namespace
+
+/// Header of the log file, it describes the layout of the segments.
+struct Tasking::ChannelRecorder::FileHeader
+{
+    /// Identification of a channel log file
+    uint32_t magic;
+    /// Version of the layout
+    uint32_t version;
+    /// Number of segments in the file
+    uint32_t numberOfSegments;
+    /// Unused
+    uint32_t reserved;
+    /// Size of one segment including its header
+    uint64_t segmentSize;
+    /// Padding to place the first segment in an own cache line
+    char padding[segmentAlignment - (4u * sizeof(uint32_t)) - sizeof(uint64_t)];
+};
+
+/// Header of a segment. It is only written by the thread which claimed the segment.
+struct Tasking::ChannelRecorder::SegmentHeader
+{
+    /// Number of bytes used by the records of the segment
+    std::atomic<uint64_t> used;
+    /// Number of records in the segment
+    std::atomic<uint64_t> records;
+    /// Number of records lost because the segment was full
+    std::atomic<uint64_t> lost;
+    /// Padding to place the records in an own cache line
+    char padding[segmentAlignment - (3u * sizeof(std::atomic<uint64_t>))];
+};
+
+// ----------------
+
+Tasking::ChannelRecorder::ChannelRecorder(const char* fileName, unsigned int p_numberOfSegments,
+                                          size_t p_segmentSize) :
+    mapping(nullptr),
+    mappedSize(0u),
+    fd(open(fileName, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)),
+    numberOfSegments((p_numberOfSegments < maximumSegments) ? p_numberOfSegments : maximumSegments),
+    segmentSize(((p_segmentSize + sizeof(SegmentHeader) + segmentAlignment) - 1u) & ~(segmentAlignment - 1u)),
+    claimedSegments(0u),
+    lostRecords(0u),
+    hasSegmentKey(pthread_key_create(&segmentKey, nullptr) == 0)
+{
+    size_t fileSize = sizeof(FileHeader) + (numberOfSegments * segmentSize);
+    // The file is extended with zeros, so all segments are empty
+    if (hasSegmentKey && (fd >= 0) && (ftruncate(fd, static_cast<off_t>(fileSize)) == 0))
+    {
+        void* file = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (file != MAP_FAILED)
+        {
+            mapping = static_cast<char*>(file);
+            mappedSize = fileSize;
+            FileHeader* header = reinterpret_cast<FileHeader*>(mapping);
+            header->version = fileVersion;
+            header->numberOfSegments = numberOfSegments;
+            header->segmentSize = segmentSize;
+            header->magic = fileMagic;
+        }
+    }
+}
+
+// ----------------
+
+Tasking::ChannelRecorder::~ChannelRecorder(void)
+{
+    if (mapping != nullptr)
+    {
+        munmap(mapping, mappedSize);
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    if (hasSegmentKey)
+    {
+        pthread_key_delete(segmentKey);
+    }
+}
+
+// ----------------
+
+bool
+Tasking::ChannelRecorder::isValid(void) const
+{
+    return (mapping != nullptr);
+}
+
+// ----------------
+
+Tasking::ChannelRecorder::SegmentHeader*
+Tasking::ChannelRecorder::getSegment(void)
+{
+    // The thread specific value is the index of the segment plus one, so it is zero for a thread without segment
+    uintptr_t claimed = reinterpret_cast<uintptr_t>(pthread_getspecific(segmentKey));
+    if (claimed == 0u)
+    {
+        // First push of the thread, claim a new segment. A thread finding no segment left keeps an index behind the
+        // last segment, so it never claims again.
+        claimed = static_cast<uintptr_t>(claimedSegments.fetch_add(1u, std::memory_order_relaxed)) + 1u;
+        pthread_setspecific(segmentKey, reinterpret_cast<void*>(claimed));
+    }
+    unsigned int segment = static_cast<unsigned int>(claimed - 1u);
+
+    SegmentHeader* header = nullptr;
+    if (segment < numberOfSegments)
+    {
+        header = reinterpret_cast<SegmentHeader*>(mapping + sizeof(FileHeader) + (segment * segmentSize));
+    }
+    return header;
+}
+
+// ----------------
+
+void
+Tasking::ChannelRecorder::tap(const Channel& channel, const void* data, size_t size)
+{
+    SegmentHeader* segment = (mapping != nullptr) ? getSegment() : nullptr;
+    if (segment == nullptr)
+    {
+        lostRecords.fetch_add(1u, std::memory_order_relaxed);
+    }
+    else
+    {
+        // Only the calling thread writes into the segment, so no read-modify-write operation is needed
+        uint64_t used = segment->used.load(std::memory_order_relaxed);
+        size_t recordSize = getRecordSize(size);
+        if ((used + recordSize) > (segmentSize - sizeof(SegmentHeader)))
+        {
+            segment->lost.store(segment->lost.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+        }
+        else
+        {
+            char* target = reinterpret_cast<char*>(segment) + sizeof(SegmentHeader) + used;
+            ChannelLogRecord* record = reinterpret_cast<ChannelLogRecord*>(target);
+            record->time = getMonotonicTime();
+            record->channelId = channel.getChannelId();
+            record->size = static_cast<uint32_t>(size);
+            if (size > 0u)
+            {
+                std::memcpy(target + sizeof(ChannelLogRecord), data, size);
+            }
+            // Publish the record for a reader of the mapped file
+            segment->records.store(segment->records.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+            segment->used.store(used + recordSize, std::memory_order_release);
+        }
+    }
+}
+
+// ----------------
+
+uint64_t
+Tasking::ChannelRecorder::getNumberOfRecords(void) const
+{
+    uint64_t records = 0u;
+    for (unsigned int i = 0u; (mapping != nullptr) && (i < numberOfSegments); ++i)
+    {
+        const SegmentHeader* segment =
+            reinterpret_cast<const SegmentHeader*>(mapping + sizeof(FileHeader) + (i * segmentSize));
+        records += segment->records.load(std::memory_order_relaxed);
+    }
+    return records;
+}
+
+// ----------------
+
+uint64_t
+Tasking::ChannelRecorder::getNumberOfLostRecords(void) const
+{
+    uint64_t lost = lostRecords.load(std::memory_order_relaxed);
+    for (unsigned int i = 0u; (mapping != nullptr) && (i < numberOfSegments); ++i)
+    {
+        const SegmentHeader* segment =
+            reinterpret_cast<const SegmentHeader*>(mapping + sizeof(FileHeader) + (i * segmentSize));
+        lost += segment->lost.load(std::memory_order_relaxed);
+    }
+    return lost;
+}
+
+// ----------------
+
+void
+Tasking::ChannelRecorder::flush(void)
+{
+    if (mapping != nullptr)
+    {
+        msync(mapping, mappedSize, MS_SYNC);
+    }
+}
+
+// ====================================
+
+Tasking::ChannelReplayer::Handler::~Handler(void)
+{
+}
+
+// ----------------
+
+Tasking::ChannelReplayer::ChannelReplayer(const char* fileName) :
+    mapping(nullptr), mappedSize(0u), fd(open(fileName, O_RDONLY | O_CLOEXEC)), numberOfSegments(0u), segmentSize(0u)
+{
+    struct stat fileState;
+    if ((fd >= 0) && (fstat(fd, &fileState) == 0)
+        && (static_cast<size_t>(fileState.st_size) >= sizeof(ChannelRecorder::FileHeader)))
+    {
+        size_t fileSize = static_cast<size_t>(fileState.st_size);
+        void* file = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+        if (file != MAP_FAILED)
+        {
+            const ChannelRecorder::FileHeader* header = static_cast<const ChannelRecorder::FileHeader*>(file);
+            uint64_t segmentsSize = header->numberOfSegments * header->segmentSize;
+            // Only a file with the layout of the recorder is replayed
+            if ((header->magic == fileMagic) && (header->version == fileVersion)
+                && (header->numberOfSegments <= ChannelRecorder::maximumSegments)
+                && (header->segmentSize >= sizeof(ChannelRecorder::SegmentHeader))
+                && ((header->segmentSize % segmentAlignment) == 0u) && (header->segmentSize <= fileSize)
+                && (fileSize >= (sizeof(ChannelRecorder::FileHeader) + segmentsSize)))
+            {
+                mapping = static_cast<char*>(file);
+                mappedSize = fileSize;
+                numberOfSegments = header->numberOfSegments;
+                segmentSize = header->segmentSize;
+            }
+            else
+            {
+                munmap(file, fileSize);
+            }
+        }
+    }
+    rewind();
+}
+
+// ----------------
+
+Tasking::ChannelReplayer::~ChannelReplayer(void)
+{
+    if (mapping != nullptr)
+    {
+        munmap(mapping, mappedSize);
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+}
+
+// ----------------
+
+bool
+Tasking::ChannelReplayer::isValid(void) const
+{
+    return (mapping != nullptr);
+}
+
+// ----------------
+
+void
+Tasking::ChannelReplayer::rewind(void)
+{
+    for (unsigned int i = 0u; i < ChannelRecorder::maximumSegments; ++i)
+    {
+        cursors[i] = 0u;
+    }
+}
+
+// ----------------
+
+const Tasking::ChannelLogRecord*
+Tasking::ChannelReplayer::next(void)
+{
+    const ChannelLogRecord* record = nullptr;
+    unsigned int recordSegment = 0u;
+    // Merge the segments by the time of their next records
+    for (unsigned int i = 0u; (mapping != nullptr) && (i < numberOfSegments); ++i)
+    {
+        const char* segment = mapping + sizeof(ChannelRecorder::FileHeader) + (i * segmentSize);
+        const ChannelRecorder::SegmentHeader* header = reinterpret_cast<const ChannelRecorder::SegmentHeader*>(segment);
+        const uint64_t used = header->used.load(std::memory_order_acquire);
+        // The segment of a truncated or corrupt log ends at the first record which does not fit into the used space
+        const ChannelLogRecord* candidate = nullptr;
+        if ((used <= (segmentSize - sizeof(ChannelRecorder::SegmentHeader)))
+            && ((cursors[i] + sizeof(ChannelLogRecord)) <= used))
+        {
+            candidate = reinterpret_cast<const ChannelLogRecord*>(segment + sizeof(ChannelRecorder::SegmentHeader)
+                                                                  + cursors[i]);
+            if ((cursors[i] + getRecordSize(candidate->size)) > used)
+            {
+                candidate = nullptr;
+            }
+        }
+        if ((candidate != nullptr) && ((record == nullptr) || (candidate->time < record->time)))
+        {
+            record = candidate;
+            recordSegment = i;
+        }
+    }
+    if (record != nullptr)
+    {
+        cursors[recordSegment] += getRecordSize(record->size);
+    }
+    return record;
+}
+
+// ----------------
+
+uint64_t
+Tasking::ChannelReplayer::replay(Handler& handler, SchedulerUnitTest& scheduler, bool paced)
+{
+    uint64_t replayed = 0u;
+    uint64_t startTime = 0u;
+    Time steppedTime = 0u;
+    rewind();
+    for (const ChannelLogRecord* record = next(); record != nullptr; record = next())
+    {
+        if (replayed == 0u)
+        {
+            startTime = record->time;
+        }
+        // Events which are due before the record fire before the record is published
+        if (paced)
+        {
+            Time recordTime = fromNanoseconds(record->time - startTime);
+            if (recordTime > steppedTime)
+            {
+                scheduler.schedule(recordTime - steppedTime);
+                steppedTime = recordTime;
+            }
+        }
+        handler.replay(record->channelId, (record->size > 0u) ? (record + 1) : nullptr, record->size);
+        scheduler.schedule();
+        ++replayed;
+    }
+    return replayed;
+}
+
+// ----------------
+
+uint64_t
+Tasking::ChannelReplayer::replay(Handler& handler, bool paced)
+{
+    uint64_t replayed = 0u;
+    uint64_t startTime = 0u;
+    uint64_t replayStartTime = getMonotonicTime();
+    rewind();
+    for (const ChannelLogRecord* record = next(); record != nullptr; record = next())
+    {
+        if (replayed == 0u)
+        {
+            startTime = record->time;
+        }
+        if (paced)
+        {
+            // Wait until the same time has passed since the start of the replay as since the first record
+            uint64_t wakeUpTime = replayStartTime + (record->time - startTime);
+            struct timespec wakeUp;
+            wakeUp.tv_sec = static_cast<time_t>(wakeUpTime / 1000000000u);
+            wakeUp.tv_nsec = static_cast<long>(wakeUpTime % 1000000000u);
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUp, nullptr) == EINTR)
+            {
+            }
+        }
+        handler.replay(record->channelId, (record->size > 0u) ? (record + 1) : nullptr, record->size);
+        ++replayed;
+    }
+    return replayed;
+}
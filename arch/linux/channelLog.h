@@ -0,0 +1,236 @@
+/*
+ * channelLog.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_ARCH_LINUX_CHANNELLOG_H_
+#define TASKING_ARCH_LINUX_CHANNELLOG_H_
+
+#include <atomic>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <taskChannel.h>
+
+namespace Tasking
+{
+
+class SchedulerUnitTest;
+
+/**
+ * Header of one record in a channel log. The published data follows the header and is padded to a multiple of eight
+ * bytes.
+ */
+struct ChannelLogRecord
+{
+    /// Time of the push in nanoseconds of CLOCK_MONOTONIC
+    uint64_t time;
+    /// Identification of the pushed channel
+    uint32_t channelId;
+    /// Size of the published data in bytes
+    uint32_t size;
+};
+
+/**
+ * Recorder of the traffic of channels into a memory-mapped, append-only log file. The recorder is assigned as tap to
+ * the channels to record, e.g. channel.setTap(&recorder). Each push is appended with a time stamp and the published
+ * data of the channel.
+ *
+ * The log is divided into segments. Each thread which pushes a recorded channel, e.g. an executor, claims its own
+ * segment at its first push, so the producers never contend on the log. A push is lost when no segment is left for
+ * the thread or the segment of the thread is full.
+ *
+ * @see ChannelReplayer
+ */
+class ChannelRecorder : public ChannelTap
+{
+    friend class ChannelReplayer;
+
+public:
+    /// Maximal number of segments in a log
+    static const unsigned int maximumSegments = 64u;
+
+    /**
+     * Create the log file and map it into memory. An existing file is overwritten.
+     * @param fileName Name of the log file.
+     * @param numberOfSegments Number of segments, at most maximumSegments. It limits the number of recording threads.
+     * @param segmentSize Space for the records of one segment in bytes. A segment with its header is rounded up to a
+     * multiple of 64 bytes.
+     */
+    ChannelRecorder(const char* fileName, unsigned int numberOfSegments, size_t segmentSize);
+
+    /// Unmap and close the log file.
+    ~ChannelRecorder(void) override;
+
+    // Disabling copy constructor
+    ChannelRecorder(const ChannelRecorder&) = delete;
+    // Disabling assignment operator
+    ChannelRecorder& operator=(const ChannelRecorder&) = delete;
+
+    /// @return True when the log file is created and mapped.
+    bool isValid(void) const;
+
+    /**
+     * Append a push of a channel to the segment of the calling thread.
+     * @param channel The pushed channel.
+     * @param data Pointer to the published data, null if the channel has no data.
+     * @param size Size of the published data in bytes.
+     */
+    void tap(const Channel& channel, const void* data, size_t size) override;
+
+    /// @return Number of recorded pushes in all segments.
+    uint64_t getNumberOfRecords(void) const;
+
+    /// @return Number of pushes which are not recorded, because no segment or no space in a segment was left.
+    uint64_t getNumberOfLostRecords(void) const;
+
+    /// Write the log synchronously to the file, e.g. before the file is copied while the recorder is still in use.
+    void flush(void);
+
+protected:
+    /// Header of the log file
+    struct FileHeader;
+
+    /// Header of a segment
+    struct SegmentHeader;
+
+    /**
+     * Get the segment of the calling thread. A thread claims a new segment at its first call.
+     * @return Header of the segment or nullptr if no segment is left.
+     */
+    SegmentHeader* getSegment(void);
+
+    /// Start of the mapped log file
+    char* mapping;
+
+    /// Size of the mapped log file
+    size_t mappedSize;
+
+    /// File descriptor of the log file
+    int fd;
+
+    /// Number of segments in the log
+    const unsigned int numberOfSegments;
+
+    /// Size of one segment including its header
+    const size_t segmentSize;
+
+    /// Number of segments claimed by threads
+    std::atomic<unsigned int> claimedSegments;
+
+    /// Number of pushes lost because no segment was left
+    std::atomic<uint64_t> lostRecords;
+
+    /// Key of the thread specific value holding the segment of a thread in this recorder
+    pthread_key_t segmentKey;
+
+    /// True when the key of the thread specific segment is created
+    const bool hasSegmentKey;
+};
+
+/**
+ * Replayer of a channel log written by a ChannelRecorder. The records of all segments are replayed in the order of
+ * their time stamps. A handler of the application maps each record to its channel, e.g. by pushing the data into a
+ * FIFO with the recorded channel identification. The replay runs as fast as possible or at the original pacing.
+ *
+ * @see ChannelRecorder
+ */
+class ChannelReplayer
+{
+public:
+    /// Interface of the application to publish the replayed records in its channels.
+    class Handler
+    {
+    public:
+        /// Destructor needed by virtual methods
+        virtual ~Handler(void);
+
+        /**
+         * Publish a recorded push.
+         * @param channelId Identification of the recorded channel.
+         * @param data Pointer to the recorded data, null if the channel had no data.
+         * @param size Size of the recorded data in bytes.
+         */
+        virtual void replay(ChannelId channelId, const void* data, size_t size) = 0;
+    };
+
+    /**
+     * Map a log file for reading.
+     * @param fileName Name of the log file.
+     */
+    explicit ChannelReplayer(const char* fileName);
+
+    /// Unmap and close the log file.
+    ~ChannelReplayer(void);
+
+    // Disabling copy constructor
+    ChannelReplayer(const ChannelReplayer&) = delete;
+    // Disabling assignment operator
+    ChannelReplayer& operator=(const ChannelReplayer&) = delete;
+
+    /// @return True when the log file is mapped and has a valid layout.
+    bool isValid(void) const;
+
+    /**
+     * Replay the log into a unit test scheduler. After each record the activated tasks are executed by the
+     * scheduler. At original pacing the clock of the scheduler is stepped by the recorded time between two records,
+     * so events of the scheduler fire between the records like in the recorded run.
+     *
+     * @param handler Handler which publishes the records.
+     * @param scheduler The unit test scheduler which executes the tasks.
+     * @param paced True to step the clock by the recorded time, false to replay without time steps.
+     * @return Number of replayed records.
+     */
+    uint64_t replay(Handler& handler, SchedulerUnitTest& scheduler, bool paced);
+
+    /**
+     * Replay the log in the calling thread, e.g. into the channels of a running scheduler.
+     *
+     * @param handler Handler which publishes the records.
+     * @param paced True to wait between two records for the recorded time, false to replay as fast as possible.
+     * @return Number of replayed records.
+     */
+    uint64_t replay(Handler& handler, bool paced);
+
+protected:
+    /// Start the replay again at the first record of each segment.
+    void rewind(void);
+
+    /// @return The next record in order of time or nullptr at the end of the log.
+    const ChannelLogRecord* next(void);
+
+    /// Start of the mapped log file
+    char* mapping;
+
+    /// Size of the mapped log file
+    size_t mappedSize;
+
+    /// File descriptor of the log file
+    int fd;
+
+    /// Number of segments in the log
+    unsigned int numberOfSegments;
+
+    /// Size of one segment including its header
+    size_t segmentSize;
+
+    /// Offset of the next record in each segment
+    size_t cursors[ChannelRecorder::maximumSegments];
+};
+
+} // namespace Tasking
+
+#endif /* TASKING_ARCH_LINUX_CHANNELLOG_H_ */
@@ -43,6 +43,14 @@ extern "C"
             Tasking::Time nextStartTime = clock->getNextStartTime();
             clock->timeQueueMutex.leave();
 
+            // Signal the scheduler for all events in the past before going to sleep. An event which got pending
+            // after the previous wake-up is not in the future anymore, so there is no further wake-up for it.
+            if (clock->isPending())
+            {
+                // Signal the scheduler, it will perform pending events
+                static_cast<SchedulerExecutionModel*>(&(clock->scheduler))->signal();
+            }
+
             // The queue is empty or all events are in the past, sleep until notification for a new event
             if (nextStartTime == 0)
             {
@@ -55,7 +63,7 @@ extern "C"
                 // time can pass here
                 Time currentTime = clock->getTime();
                 // if nextStartTime is still greater than current time, we go to sleep
-                // otherwise, time has passed, clock->isPending() will signal and we go to the next cycle
+                // otherwise, time has passed and the next cycle will signal the pending event
                 if (nextStartTime > currentTime)
                 {
                     clock->computeAbsoluteWakeUpTime(nextStartTime - currentTime);
@@ -63,14 +71,6 @@ extern "C"
                     pthread_cond_timedwait(&(clock->m_cond), &(clock->m_mutex), &(clock->wakeUpTime));
                 }
             }
-
-            // There are several reasons for the wake-up.
-            // Do only some actions when an event is pending, else start next clock thread cycle
-            if (clock->isPending())
-            {
-                // Signal the scheduler, it will perform pending events
-                static_cast<SchedulerExecutionModel*>(&(clock->scheduler))->signal();
-            }
         } // end of loop over waiting on empty clock list
 
         // Unlocking the mutex. It's needed never again.
@@ -89,6 +89,9 @@ Tasking::ClockExecutionModel::ClockExecutionModel(Scheduler& p_scheduler) : Cloc
 {
     // Request the zero time as basis to define periodical timer.
     clock_gettime(CLOCK_REALTIME, &zeroTime);
+#ifdef TASKING_TSC_CLOCK
+    zeroNanoseconds = timeSource.getNanoseconds();
+#endif
 
     // Setting time structure for next wake-up to zero. This will hold clock thread in outer running loop
     wakeUpTime.tv_sec = 0;
@@ -138,10 +141,15 @@ Tasking::ClockExecutionModel::~ClockExecutionModel(void)
 Tasking::Time
 Tasking::ClockExecutionModel::getTime(void) const
 {
+#ifdef TASKING_TSC_CLOCK
+    return fromNanoseconds(timeSource.getNanoseconds() - zeroNanoseconds);
+#else
     struct timespec now;
     clock_gettime(CLOCK_REALTIME, &now);
-    // Return time as milliseconds
-    return (now.tv_sec - zeroTime.tv_sec) * 1000 + (now.tv_nsec - zeroTime.tv_nsec) / 1000000;
+    // Return time in ticks of the tasking time resolution
+    return fromSeconds(now.tv_sec - zeroTime.tv_sec) + fromNanoseconds(now.tv_nsec)
+        - fromNanoseconds(zeroTime.tv_nsec);
+#endif
 }
 
 // ----------------
@@ -149,12 +157,15 @@ Tasking::ClockExecutionModel::getTime(void) const
 void
 Tasking::ClockExecutionModel::setZeroTime(Tasking::Time offset)
 {
+#ifdef TASKING_TSC_CLOCK
+    zeroNanoseconds = timeSource.getNanoseconds() - toNanoseconds(offset);
+#endif
     // Request the zero time from the system
     struct timespec newZeroTime;
     clock_gettime(CLOCK_REALTIME, &newZeroTime);
     // Correct by offset time as new start value of the clock
-    newZeroTime.tv_sec -= offset / 1000;
-    newZeroTime.tv_nsec -= offset * 1000000;
+    newZeroTime.tv_sec -= offset / ticksPerSecond;
+    newZeroTime.tv_nsec -= toNanoseconds(offset % ticksPerSecond);
     if (newZeroTime.tv_nsec < 0)
     {
         newZeroTime.tv_nsec += 1000000000;
@@ -171,9 +182,9 @@ void
 Tasking::ClockExecutionModel::computeAbsoluteWakeUpTime(Time timeSpan)
 {
     clock_gettime(CLOCK_REALTIME, &wakeUpTime);
-    wakeUpTime.tv_sec += timeSpan / 1000;
-    wakeUpTime.tv_nsec += (timeSpan % 1000) * 1000000;
-    if (wakeUpTime.tv_nsec > 1000000000)
+    wakeUpTime.tv_sec += timeSpan / ticksPerSecond;
+    wakeUpTime.tv_nsec += toNanoseconds(timeSpan % ticksPerSecond);
+    if (wakeUpTime.tv_nsec >= 1000000000)
     {
         wakeUpTime.tv_nsec -= 1000000000;
         wakeUpTime.tv_sec++;
@@ -21,6 +21,7 @@
 
 #include <pthread.h>
 #include <impl/clock_impl.h>
+#include "timeSource.h"
 
 namespace Tasking
 {
@@ -31,7 +32,12 @@ extern "C"
     void* clockThread(void*);
 }
 
-/// Implementation of a clock execution model with the POSIX API.
+/**
+ * Implementation of a clock execution model with the POSIX API. The clock thread waits with timed waits on
+ * CLOCK_REALTIME for relative time spans. By default the time is also taken from CLOCK_REALTIME. When the framework is
+ * build with TASKING_TSC_CLOCK, e.g. by the build option linuxClock = tsc, the time is taken from a TimeSource, which
+ * reads the calibrated TSC of the processor without a call to the system.
+ */
 class ClockExecutionModel : public Clock
 {
     friend void* clockThread(void*);
@@ -46,7 +52,7 @@ public:
     /// Free memory of pthread stuff and terminate pthread thread
     ~ClockExecutionModel(void);
 
-    /// @return Compute the Tasking time requested from the POSIX real time clock since start.
+    /// @return Compute the Tasking time requested from the POSIX real time clock or the time source since start.
     Time getTime(void) const override;
 
     /**
@@ -94,6 +100,14 @@ protected:
 
     /// Absolute time point when the clock thread should wake up from sleeping
     struct timespec wakeUpTime;
+
+#ifdef TASKING_TSC_CLOCK
+    /// Source of the time with low overhead
+    TimeSource timeSource;
+
+    /// Time of the time source in nanoseconds which is zero time of the tasking time.
+    uint64_t zeroNanoseconds;
+#endif
 };
 
 } // namespace Tasking
@@ -0,0 +1,89 @@
+/*
+ * executorClockExecutionModel.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "schedulerExecutionModel.h"
+#include "taskTypes.h"
+
+Tasking::ExecutorClockExecutionModel::ExecutorClockExecutionModel(Scheduler& p_scheduler) : Clock(p_scheduler)
+{
+    // Request the zero time as basis to define periodical timer.
+    clock_gettime(CLOCK_MONOTONIC, &zeroTime);
+}
+
+// ----------------
+
+Tasking::Time
+Tasking::ExecutorClockExecutionModel::getTime(void) const
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    // Return time in ticks of the tasking time resolution
+    return fromSeconds(now.tv_sec - zeroTime.tv_sec) + fromNanoseconds(now.tv_nsec)
+        - fromNanoseconds(zeroTime.tv_nsec);
+}
+
+// ----------------
+
+void
+Tasking::ExecutorClockExecutionModel::setZeroTime(Tasking::Time offset)
+{
+    // Request the zero time from the system
+    struct timespec newZeroTime;
+    clock_gettime(CLOCK_MONOTONIC, &newZeroTime);
+    // Correct by offset time as new start value of the clock
+    newZeroTime.tv_sec -= offset / ticksPerSecond;
+    newZeroTime.tv_nsec -= toNanoseconds(offset % ticksPerSecond);
+    if (newZeroTime.tv_nsec < 0)
+    {
+        newZeroTime.tv_nsec += 1000000000;
+        newZeroTime.tv_sec--;
+    }
+    // Copy to zero time
+    zeroTime.tv_nsec = newZeroTime.tv_nsec;
+    zeroTime.tv_sec = newZeroTime.tv_sec;
+}
+
+// ----------------
+
+bool
+Tasking::ExecutorClockExecutionModel::getWakeUpTime(struct timespec& wakeUpTime)
+{
+    timeQueueMutex.enter();
+    Time nextStartTime = getNextStartTime();
+    timeQueueMutex.leave();
+
+    if (nextStartTime != 0u)
+    {
+        wakeUpTime.tv_sec = zeroTime.tv_sec + nextStartTime / ticksPerSecond;
+        wakeUpTime.tv_nsec = zeroTime.tv_nsec + toNanoseconds(nextStartTime % ticksPerSecond);
+        if (wakeUpTime.tv_nsec >= 1000000000)
+        {
+            wakeUpTime.tv_nsec -= 1000000000;
+            wakeUpTime.tv_sec++;
+        }
+    }
+    return nextStartTime != 0u;
+}
+
+// ----------------
+
+void
+Tasking::ExecutorClockExecutionModel::startTimer(Time)
+{
+    static_cast<SchedulerExecutionModel&>(scheduler).wakeUpTimerWaiter();
+}
@@ -0,0 +1,76 @@
+/*
+ * executorClockExecutionModel.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_ARCH_LINUX_EXECUTORCLOCKEXECUTIONMODEL_H_
+#define TASKING_ARCH_LINUX_EXECUTORCLOCKEXECUTIONMODEL_H_
+
+#include <time.h>
+#include <impl/clock_impl.h>
+
+namespace Tasking
+{
+
+/**
+ * Implementation of a clock execution model without an own thread. One idle executor of the scheduler becomes the
+ * timer waiter. It sleeps with a timed wait on its signaler until the next event of the clock queue and handles the
+ * pending events directly after the wake up. So an expiring event needs no switch from a clock thread to an executor.
+ *
+ * The time is taken from CLOCK_MONOTONIC. The clock is used by the scheduler when the framework is build with
+ * TASKING_EXECUTOR_CLOCK, e.g. by the build option linuxClock = executor.
+ */
+class ExecutorClockExecutionModel : public Clock
+{
+public:
+    /**
+     * Initialize clock and take the zero time.
+     * @param scheduler Reference to the executor
+     */
+    ExecutorClockExecutionModel(Scheduler& scheduler);
+
+    /// @return Compute the Tasking time requested from the POSIX monotonic clock since start.
+    Time getTime(void) const override;
+
+    /**
+     * Method to set the zero time.
+     *
+     * @param offset Offset time to which the zero time is adjusted. An immediate subsequent call to get
+     * time will than deliver the value of this parameter.
+     */
+    void setZeroTime(Time offset);
+
+    /**
+     * Compute the next wake up time of the timer waiter.
+     * @param wakeUpTime [out] Absolute time of CLOCK_MONOTONIC for the wake up, if the result is true.
+     * @return True when an event is in the future, false if the clock queue is empty or all events are pending.
+     */
+    bool getWakeUpTime(struct timespec& wakeUpTime);
+
+protected:
+    /**
+     * Wake up the timer waiter to wait on the new first event, or an idle executor to become the timer waiter.
+     * @param timeSpan The time after which the timer shall expire. Not used, the waiter computes the time itself.
+     */
+    void startTimer(Time timeSpan) override;
+
+    /// Monotonic time of the computer which is zero time of the tasking time.
+    struct timespec zeroTime;
+};
+
+} // namespace Tasking
+
+#endif /* TASKING_ARCH_LINUX_EXECUTORCLOCKEXECUTIONMODEL_H_ */
@@ -0,0 +1,86 @@
+/*
+ * fdChannel.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sys/epoll.h>
+#include "fdChannel.h"
+
+static_assert((static_cast<uint32_t>(Tasking::FdChannel::readable) == EPOLLIN)
+                  && (static_cast<uint32_t>(Tasking::FdChannel::writable) == EPOLLOUT),
+              "Interests of the file descriptor channel shall match epoll events.");
+
+Tasking::FdChannel::FdChannel(Reactor& p_reactor, int p_fd, uint32_t p_interest, ChannelId channelId) :
+    Channel(channelId), reactor(p_reactor), fd(p_fd), interest(p_interest), readyEvents(0u), registered(false)
+{
+}
+
+// ----------------
+
+Tasking::FdChannel::~FdChannel(void)
+{
+    reactor.remove(*this);
+}
+
+// ----------------
+
+bool
+Tasking::FdChannel::arm(void)
+{
+    return reactor.arm(*this);
+}
+
+// ----------------
+
+bool
+Tasking::FdChannel::isReadable(void) const
+{
+    return (readyEvents & EPOLLIN) != 0u;
+}
+
+// ----------------
+
+bool
+Tasking::FdChannel::isWritable(void) const
+{
+    return (readyEvents & EPOLLOUT) != 0u;
+}
+
+// ----------------
+
+bool
+Tasking::FdChannel::isClosed(void) const
+{
+    return (readyEvents & (EPOLLERR | EPOLLHUP)) != 0u;
+}
+
+// ----------------
+
+void
+Tasking::FdChannel::reset(void)
+{
+    Channel::reset();
+    reactor.rearm(*this);
+}
+
+// ----------------
+
+void
+Tasking::FdChannel::ready(uint32_t events)
+{
+    readyEvents = events;
+    push();
+}
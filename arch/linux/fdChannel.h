@@ -0,0 +1,125 @@
+/*
+ * fdChannel.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_ARCH_LINUX_FDCHANNEL_H_
+#define TASKING_ARCH_LINUX_FDCHANNEL_H_
+
+#include <stdint.h>
+#include <taskChannel.h>
+#include "reactor.h"
+
+namespace Tasking
+{
+
+/**
+ * Channel which is pushed by a reactor when a file descriptor becomes readable or writable. Connected tasks should
+ * perform only non-blocking I/O on the descriptor, e.g. read until EAGAIN.
+ *
+ * The watch is armed by a call to arm and again whenever the channel is reset, i.e. after the connected task is
+ * finalized. So the channel pushes at most once per execution of the task and a readiness which is not consumed by
+ * the task leads to a new push after the task.
+ *
+ * @see Reactor
+ */
+class FdChannel : public Channel
+{
+    friend void* reactorThread(void*);
+    friend class Reactor;
+
+public:
+    /// Readiness of the file descriptor the channel can wait for. The values can be combined.
+    enum Interest : uint32_t
+    {
+        /// Data is available to read
+        readable = 0x001u,
+        /// Data can be written without blocking
+        writable = 0x004u
+    };
+
+    /**
+     * Initialize the channel without watching the file descriptor.
+     * @param reactor Reactor which waits on the readiness of the file descriptor.
+     * @param fd File descriptor of the channel. It should be in non-blocking mode.
+     * @param interest Combination of the interests to wait for.
+     * @param channelId Identification of the channel.
+     */
+    FdChannel(Reactor& reactor, int fd, uint32_t interest = readable, ChannelId channelId = 0);
+
+    /// Remove the channel from the reactor
+    ~FdChannel(void) override;
+
+    // Disabling copy constructor
+    FdChannel(const FdChannel&) = delete;
+    // Disabling assignment operator
+    FdChannel& operator=(const FdChannel&) = delete;
+
+    /**
+     * Start to watch the file descriptor. Call it after the inputs of the tasks are connected to the channel.
+     * @return True when the reactor watches the file descriptor.
+     */
+    bool arm(void);
+
+    /// @return The file descriptor of the channel
+    int getFd(void) const;
+
+    /// @return True when the last push was caused by readable data.
+    bool isReadable(void) const;
+
+    /// @return True when the last push was caused by the possibility to write.
+    bool isWritable(void) const;
+
+    /// @return True when the last push was caused by an error or a hang up of the file descriptor.
+    bool isClosed(void) const;
+
+protected:
+    /// Reset associated inputs and watch the file descriptor for the next push.
+    void reset(void) override;
+
+    /**
+     * Called by the reactor thread when the file descriptor is ready.
+     * @param events The epoll events of the readiness.
+     */
+    void ready(uint32_t events);
+
+    /// Reactor waiting on the file descriptor
+    Reactor& reactor;
+
+    /// The watched file descriptor
+    const int fd;
+
+    /// Interest of the channel in epoll events
+    const uint32_t interest;
+
+    /// Epoll events of the last push
+    volatile uint32_t readyEvents;
+
+    /// True when the file descriptor is registered at the reactor
+    bool registered;
+};
+
+} // namespace Tasking
+
+// ----------- inlines -----------
+
+inline int
+Tasking::FdChannel::getFd(void) const
+{
+    return fd;
+}
+
+#endif /* TASKING_ARCH_LINUX_FDCHANNEL_H_ */
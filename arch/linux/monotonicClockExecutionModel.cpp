@@ -0,0 +1,176 @@
+/*
+ * monotonicClockExecutionModel.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <cerrno>
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include "schedulerExecutionModel.h"
+#include "taskTypes.h"
+
+namespace Tasking
+{
+extern "C"
+{
+    void*
+    monotonicClockThread(void* clockExecutionModel)
+    {
+        MonotonicClockExecutionModel* clock = static_cast<MonotonicClockExecutionModel*>(clockExecutionModel);
+
+        // Arming of the timer is protected against a concurrent start of the timer
+        pthread_mutex_lock(&(clock->m_mutex));
+        while (clock->running)
+        {
+            // On linux, this method needs to be protected from concurrent access by the scheduler/executors
+            clock->timeQueueMutex.enter();
+            Tasking::Time nextStartTime = clock->getNextStartTime();
+            clock->timeQueueMutex.leave();
+
+            // Signal the scheduler for all events in the past before going to sleep.
+            if (clock->isPending())
+            {
+                static_cast<SchedulerExecutionModel*>(&(clock->scheduler))->signal();
+            }
+
+            // Arm absolute wake up time of next event. When the queue is empty or all events are in the past, the
+            // timer is disarmed and the clock sleeps until the timer is started for a new event.
+            clock->armAt(nextStartTime);
+            pthread_mutex_unlock(&(clock->m_mutex));
+
+            // Sleep until the timer expires. Interrupts only lead to a new cycle.
+            uint64_t expirations;
+            ssize_t result = read(clock->timerFd, &expirations, sizeof(expirations));
+            assert((result == sizeof(expirations)) || (errno == EINTR));
+            (void)result;
+
+            pthread_mutex_lock(&(clock->m_mutex));
+        }
+        pthread_mutex_unlock(&(clock->m_mutex));
+
+        // Terminate thread
+        pthread_exit(nullptr);
+    }
+} // extern "C"
+} // namespace Tasking
+
+// ----------------
+
+Tasking::MonotonicClockExecutionModel::MonotonicClockExecutionModel(Scheduler& p_scheduler) :
+    Clock(p_scheduler), running(true)
+{
+    // Request the zero time as basis to define periodical timer.
+    clock_gettime(CLOCK_MONOTONIC, &zeroTime);
+
+    // Set up timer and mutex before the thread is started, so no synchronization of thread start is needed.
+    timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    assert(timerFd >= 0);
+    int state = pthread_mutex_init(&m_mutex, nullptr);
+    state |= pthread_create(&m_thread, nullptr, monotonicClockThread, this);
+    assert(state == 0);
+    (void)state;
+}
+
+// ----------------
+
+Tasking::MonotonicClockExecutionModel::~MonotonicClockExecutionModel(void)
+{
+    // Terminating thread and wake it up by an immediate expiration of the timer
+    pthread_mutex_lock(&m_mutex);
+    running = false;
+    struct itimerspec wakeUp = {{0, 0}, {0, 1}};
+    timerfd_settime(timerFd, 0, &wakeUp, nullptr);
+    pthread_mutex_unlock(&m_mutex);
+    // Wait on termination of the thread
+    pthread_join(m_thread, nullptr);
+    // Release timer and mutex
+    close(timerFd);
+    pthread_mutex_destroy(&m_mutex);
+}
+
+// ----------------
+
+Tasking::Time
+Tasking::MonotonicClockExecutionModel::getTime(void) const
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    // Return time in ticks of the tasking time resolution
+    return fromSeconds(now.tv_sec - zeroTime.tv_sec) + fromNanoseconds(now.tv_nsec)
+        - fromNanoseconds(zeroTime.tv_nsec);
+}
+
+// ----------------
+
+void
+Tasking::MonotonicClockExecutionModel::setZeroTime(Tasking::Time offset)
+{
+    // Request the zero time from the system
+    struct timespec newZeroTime;
+    clock_gettime(CLOCK_MONOTONIC, &newZeroTime);
+    // Correct by offset time as new start value of the clock
+    newZeroTime.tv_sec -= offset / ticksPerSecond;
+    newZeroTime.tv_nsec -= toNanoseconds(offset % ticksPerSecond);
+    if (newZeroTime.tv_nsec < 0)
+    {
+        newZeroTime.tv_nsec += 1000000000;
+        newZeroTime.tv_sec--;
+    }
+    // Copy to zero time
+    zeroTime.tv_nsec = newZeroTime.tv_nsec;
+    zeroTime.tv_sec = newZeroTime.tv_sec;
+}
+
+// ----------------
+
+void
+Tasking::MonotonicClockExecutionModel::armAt(Time time)
+{
+    // Zero values of the expiration disarm the timer
+    struct itimerspec expiration = {{0, 0}, {0, 0}};
+    if (time != 0u)
+    {
+        expiration.it_value.tv_sec = zeroTime.tv_sec + time / ticksPerSecond;
+        expiration.it_value.tv_nsec = zeroTime.tv_nsec + toNanoseconds(time % ticksPerSecond);
+        if (expiration.it_value.tv_nsec >= 1000000000)
+        {
+            expiration.it_value.tv_nsec -= 1000000000;
+            expiration.it_value.tv_sec++;
+        }
+    }
+    int state = timerfd_settime(timerFd, TFD_TIMER_ABSTIME, &expiration, nullptr);
+    assert(state == 0);
+    (void)state;
+}
+
+// ----------------
+
+void
+Tasking::MonotonicClockExecutionModel::startTimer(Time)
+{
+    // Arm the exact activation time of the new first event instead of the time span relative to the current time.
+    pthread_mutex_lock(&m_mutex);
+    timeQueueMutex.enter();
+    Time nextStartTime = getNextStartTime();
+    timeQueueMutex.leave();
+    // When the event is already in the past the clock thread shall wake up immediately and signal the scheduler.
+    // Time point one is at the start of the clock, which is the past or now.
+    armAt((nextStartTime != 0u) ? nextStartTime : 1u);
+    pthread_mutex_unlock(&m_mutex);
+}
@@ -0,0 +1,100 @@
+/*
+ * monotonicClockExecutionModel.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_ARCH_LINUX_MONOTONICCLOCKEXECUTIONMODEL_H_
+#define TASKING_ARCH_LINUX_MONOTONICCLOCKEXECUTIONMODEL_H_
+
+#include <pthread.h>
+#include <time.h>
+#include <impl/clock_impl.h>
+
+namespace Tasking
+{
+
+extern "C"
+{
+    /// The main thread which handles clock activities of the scheduler instance with a monotonic timer.
+    void* monotonicClockThread(void*);
+}
+
+/**
+ * Implementation of a clock execution model with CLOCK_MONOTONIC and a timerfd of Linux. Time steps of the real time
+ * clock, e.g. by NTP, have no effect on the timing of events. The timer is armed with the absolute activation time of
+ * the next event, so a periodic event does not accumulate the latency of relative wake-ups.
+ *
+ * The clock is used by the scheduler when the framework is build with TASKING_MONOTONIC_CLOCK, e.g. by the build
+ * option linuxClock = monotonic.
+ */
+class MonotonicClockExecutionModel : public Clock
+{
+    friend void* monotonicClockThread(void*);
+
+public:
+    /**
+     * Initialize clock, create the timer and start the pthread to manage the clock.
+     * @param scheduler Reference to the executor
+     */
+    MonotonicClockExecutionModel(Scheduler& scheduler);
+
+    /// Terminate the pthread and close the timer
+    ~MonotonicClockExecutionModel(void);
+
+    /// @return Compute the Tasking time requested from the POSIX monotonic clock since start.
+    Time getTime(void) const override;
+
+    /**
+     * Method to set the zero time.
+     *
+     * @param offset Offset time to which the zero time is adjusted. An immediate subsequent call to get
+     * time will than deliver the value of this parameter.
+     */
+    void setZeroTime(Time offset);
+
+protected:
+    /**
+     * Arm the timer to expire at an absolute tasking time.
+     * @param time Absolute tasking time of the expiration. A time of zero disarms the timer.
+     */
+    void armAt(Time time);
+
+    /**
+     * Start the timer for a new wake up time. The timer is armed with the absolute time of the first future event in
+     * the clock queue, so the time span is not used.
+     * @param timeSpan The timer after which the trigger shall start.
+     */
+    void startTimer(Time timeSpan) override;
+
+    /// POSIX thread to handle the clock by blocking reads on the timer
+    pthread_t m_thread;
+
+    /// POSIX mutex to synchronize arming of the timer by the clock thread and by a call to startTimer.
+    pthread_mutex_t m_mutex;
+
+    /// File descriptor of the timerfd which wakes up the clock thread
+    int timerFd;
+
+    /// Flag to control the run of the clock thread during start and termination of the scheduler.
+    bool running;
+
+    /// Monotonic time of the computer which is zero time of the tasking time.
+    struct timespec zeroTime;
+};
+
+} // namespace Tasking
+
+#endif /* TASKING_ARCH_LINUX_MONOTONICCLOCKEXECUTIONMODEL_H_ */
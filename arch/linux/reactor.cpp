@@ -0,0 +1,180 @@
+/*
+ * reactor.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include "fdChannel.h"
+#include "reactor.h"
+
+namespace Tasking
+{
+extern "C"
+{
+    void*
+    reactorThread(void* p_reactor)
+    {
+        Reactor* reactor = static_cast<Reactor*>(p_reactor);
+        // Number of events handled by one wait
+        const int maximumEvents = 32;
+        struct epoll_event events[maximumEvents];
+
+        bool running = true;
+        while (running)
+        {
+            int numberOfEvents = epoll_wait(reactor->epollFd, events, maximumEvents, -1);
+            // Push all ready channels. Interrupts lead only to a new wait.
+            pthread_mutex_lock(&reactor->dispatchMutex);
+            for (int i = 0; i < numberOfEvents; ++i)
+            {
+                FdChannel* channel = static_cast<FdChannel*>(events[i].data.ptr);
+                if (channel == nullptr)
+                {
+                    // Consume the wake up
+                    uint64_t wakeUps;
+                    ssize_t result = read(reactor->wakeUpFd, &wakeUps, sizeof(wakeUps));
+                    (void)result;
+                }
+                else if (channel->registered)
+                {
+                    // A channel removed after the wait is not pushed
+                    channel->ready(events[i].events);
+                }
+            }
+            ++reactor->cycles;
+            running = reactor->running;
+            pthread_mutex_unlock(&reactor->dispatchMutex);
+            // Wake up threads waiting in a removal of a channel
+            pthread_cond_broadcast(&reactor->dispatchedCond);
+        }
+
+        pthread_exit(nullptr);
+    }
+} // extern "C"
+} // namespace Tasking
+
+// ----------------
+
+Tasking::Reactor::Reactor(void) : running(true), cycles(0u)
+{
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeUpFd = eventfd(0u, EFD_CLOEXEC | EFD_NONBLOCK);
+    assert((epollFd >= 0) && (wakeUpFd >= 0));
+    int state = pthread_mutex_init(&dispatchMutex, nullptr);
+    state |= pthread_cond_init(&dispatchedCond, nullptr);
+    // The wake up descriptor is the only one without channel
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = nullptr;
+    state |= epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeUpFd, &event);
+    state |= pthread_create(&m_thread, nullptr, reactorThread, this);
+    assert(state == 0);
+    (void)state;
+}
+
+// ----------------
+
+Tasking::Reactor::~Reactor(void)
+{
+    // Terminate thread and wake it up
+    pthread_mutex_lock(&dispatchMutex);
+    running = false;
+    pthread_mutex_unlock(&dispatchMutex);
+    wakeUpThread();
+    pthread_join(m_thread, nullptr);
+    close(wakeUpFd);
+    close(epollFd);
+    pthread_cond_destroy(&dispatchedCond);
+    pthread_mutex_destroy(&dispatchMutex);
+}
+
+// ----------------
+
+bool
+Tasking::Reactor::arm(FdChannel& channel)
+{
+    struct epoll_event event;
+    event.events = channel.interest | EPOLLONESHOT;
+    event.data.ptr = &channel;
+
+    pthread_mutex_lock(&dispatchMutex);
+    int state = epoll_ctl(epollFd, channel.registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, channel.fd, &event);
+    if (state == 0)
+    {
+        channel.registered = true;
+    }
+    pthread_mutex_unlock(&dispatchMutex);
+    return (state == 0);
+}
+
+// ----------------
+
+void
+Tasking::Reactor::rearm(FdChannel& channel)
+{
+    struct epoll_event event;
+    event.events = channel.interest | EPOLLONESHOT;
+    event.data.ptr = &channel;
+
+    // A channel removed from the reactor is not armed again
+    pthread_mutex_lock(&dispatchMutex);
+    if (channel.registered)
+    {
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, channel.fd, &event);
+    }
+    pthread_mutex_unlock(&dispatchMutex);
+}
+
+// ----------------
+
+void
+Tasking::Reactor::remove(FdChannel& channel)
+{
+    pthread_mutex_lock(&dispatchMutex);
+    bool wasRegistered = channel.registered;
+    if (wasRegistered)
+    {
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, channel.fd, nullptr);
+        channel.registered = false;
+    }
+
+    // Events of the channel can be already returned by the last wait of the reactor thread. Wait until the thread
+    // has passed the dispatch of these events, after that the channel is not accessed by the thread anymore.
+    if (wasRegistered && !pthread_equal(pthread_self(), m_thread))
+    {
+        unsigned int removedInCycle = cycles;
+        wakeUpThread();
+        while (cycles == removedInCycle)
+        {
+            pthread_cond_wait(&dispatchedCond, &dispatchMutex);
+        }
+    }
+    pthread_mutex_unlock(&dispatchMutex);
+}
+
+// ----------------
+
+void
+Tasking::Reactor::wakeUpThread(void)
+{
+    uint64_t wakeUp = 1u;
+    ssize_t written = write(wakeUpFd, &wakeUp, sizeof(wakeUp));
+    assert(written == sizeof(wakeUp));
+    (void)written;
+}
@@ -0,0 +1,105 @@
+/*
+ * reactor.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_ARCH_LINUX_REACTOR_H_
+#define TASKING_ARCH_LINUX_REACTOR_H_
+
+#include <pthread.h>
+#include <stdint.h>
+
+namespace Tasking
+{
+
+class FdChannel;
+
+extern "C"
+{
+    /// The thread which waits on the readiness of file descriptors watched by a reactor.
+    void* reactorThread(void*);
+}
+
+/**
+ * A reactor waits with epoll in an own thread on the readiness of file descriptors and pushes the associated file
+ * descriptor channels. Tasks connected to such a channel are only activated when the descriptor is ready, so they
+ * can perform non-blocking I/O and no executor is blocked by a waiting I/O operation. One reactor can serve a large
+ * number of file descriptors for several schedulers.
+ *
+ * @see FdChannel
+ */
+class Reactor
+{
+    friend void* reactorThread(void*);
+    friend class FdChannel;
+
+public:
+    /// Create the epoll instance and start the reactor thread.
+    Reactor(void);
+
+    /// Terminate the reactor thread and close the epoll instance. All channels should be destroyed before.
+    ~Reactor(void);
+
+protected:
+    /**
+     * Arm the watch of a channel for the next readiness of its file descriptor. The watch is one-shot, after the
+     * push of the channel the descriptor is not watched until it is armed again.
+     * @param channel The channel to watch
+     * @return True when the descriptor is watched.
+     */
+    bool arm(FdChannel& channel);
+
+    /**
+     * Arm the watch of a channel again when it is still registered at the reactor.
+     * @param channel The channel to watch
+     */
+    void rearm(FdChannel& channel);
+
+    /**
+     * Remove a channel from the reactor. After the call the channel will not be pushed by the reactor anymore. If the
+     * channel was watched, the call waits until the reactor thread has dispatched its last wait.
+     * @param channel The channel to remove.
+     */
+    void remove(FdChannel& channel);
+
+    /// Wake up the reactor thread for a new cycle of waiting.
+    void wakeUpThread(void);
+
+    /// POSIX thread which waits on the epoll instance
+    pthread_t m_thread;
+
+    /// File descriptor of the epoll instance
+    int epollFd;
+
+    /// Event file descriptor to wake up the reactor thread for termination and after a removal of a channel
+    int wakeUpFd;
+
+    /// Flag to control the run of the reactor thread
+    bool running;
+
+    /// Number of dispatched waits of the reactor thread, protected by dispatchMutex
+    unsigned int cycles;
+
+    /// POSIX mutex to protect the push of a channel against a concurrent removal of the channel
+    pthread_mutex_t dispatchMutex;
+
+    /// POSIX conditional variable signaled by the reactor thread after each dispatched wait
+    pthread_cond_t dispatchedCond;
+};
+
+} // namespace Tasking
+
+#endif /* TASKING_ARCH_LINUX_REACTOR_H_ */
@@ -37,40 +37,93 @@ executorThread(void* management)
 
     // Sign thread as started.
     data->running = true;
+    bool sleep = true;
 
     // Execute until running is set to false to signal termination of the framework
     while (data->running)
     {
         // Sleep until wake up from scheduler
-        data->waitOnSignal = true;
-        data->signaler.wait();
-        data->waitOnSignal = false;
+        if (sleep)
+        {
+            data->waitOnSignal = true;
+#ifdef TASKING_EXECUTOR_CLOCK
+            // Only the executor itself takes the role of the timer waiter, so no protection is needed to check it.
+            if (data->schedulerModel->timerWaiter == data)
+            {
+                // Sleep until the next event of the clock or a signal. Pending events are handled without a sleep.
+                struct timespec wakeUpTime;
+                if (data->schedulerModel->clockExecutionModel.getWakeUpTime(wakeUpTime))
+                {
+                    data->signaler.waitUntil(wakeUpTime);
+                }
+                else if (!data->schedulerImpl->clock.isPending())
+                {
+                    data->signaler.wait();
+                }
+                // Give up the role, the executor is busy until it is idle again
+                data->schedulerModel->emptySignal.enter();
+                data->schedulerModel->timerWaiter = nullptr;
+                data->schedulerModel->emptySignal.leave();
+            }
+            else
+#endif
+            {
+                data->signaler.wait();
+            }
+            data->waitOnSignal = false;
+        }
 
         // For task and event execution leave critical area to scheduler
         data->signaler.leave();
 
-        // When an event is pending, perform them.
-        if (data->schedulerImpl->clock.isPending())
+        // When an event is pending, perform them. The time of the check is reused for the first batch of events.
+        Tasking::Time currentTime;
+        if (data->schedulerImpl->clock.isPending(currentTime))
         {
-            data->schedulerImpl->handleEvents();
+            data->schedulerImpl->handleEvents(currentTime);
         }
-        for (Tasking::TaskImpl* task = data->schedulerImpl->policy.nextTask(); (task != nullptr) && data->running;
-             task = data->schedulerImpl->policy.nextTask())
+        for (Tasking::TaskImpl* task = data->schedulerImpl->policy.nextTaskFor(data->index);
+             (task != nullptr) && data->running; task = data->schedulerImpl->policy.nextTaskFor(data->index))
         {
             // Execute task
             data->schedulerImpl->execute(*task);
             // Maybe after execution of task some new events are pending
-            if (data->schedulerImpl->clock.isPending())
+            if (data->schedulerImpl->clock.isPending(currentTime))
             {
-                data->schedulerImpl->handleEvents();
+                data->schedulerImpl->handleEvents(currentTime);
             }
         }
         // Enter into critical section to have synchronization on running flag and signaler wait.
         data->signaler.enter();
         data->schedulerModel->emptySignal.enter();
-        data->nextFree = data->schedulerModel->freeExecutors;
-        data->schedulerModel->freeExecutors = data;
-        data->schedulerModel->emptySignal.signal();
+        // An event getting pending after the last check is signaled while this executor is not in the free list, so
+        // the signal is lost. Continue without sleep in this case.
+        sleep = !data->schedulerImpl->clock.isPending();
+#ifdef TASKING_VIRTUAL_CLOCK
+        // The last executor getting idle advances the virtual time to the next event and handles it without a sleep.
+        // A terminating executor is woken up without removal from the free list, so it is not counted.
+        if (sleep && data->running
+            && ((data->schedulerModel->countFreeExecutors() + 1u) == data->schedulerModel->numberOfExecutors))
+        {
+            sleep = !data->schedulerModel->clockExecutionModel.advance();
+        }
+#endif
+        if (sleep)
+        {
+#ifdef TASKING_EXECUTOR_CLOCK
+            // The first idle executor waits on the next event of the clock instead of a clock thread
+            if ((data->schedulerModel->timerWaiter == nullptr) && !data->schedulerImpl->clock.isEmtpy())
+            {
+                data->schedulerModel->timerWaiter = data;
+            }
+            else
+#endif
+            {
+                data->nextFree = data->schedulerModel->freeExecutors;
+                data->schedulerModel->freeExecutors = data;
+            }
+            data->schedulerModel->emptySignal.signal();
+        }
         data->schedulerModel->emptySignal.leave();
     } // end of execution loop
 
@@ -86,7 +139,13 @@ executorThread(void* management)
 // ================
 
 Tasking::SchedulerExecutionModel::Executor::Executor(void) :
-    thread(0u), schedulerModel(nullptr), schedulerImpl(nullptr), running(false), waitOnSignal(false), nextFree(nullptr)
+    thread(0u),
+    schedulerModel(nullptr),
+    schedulerImpl(nullptr),
+    index(0u),
+    running(false),
+    waitOnSignal(false),
+    nextFree(nullptr)
 {
 }
 
@@ -148,7 +207,8 @@ Tasking::SchedulerExecutionModel::SchedulerExecutionModel(SchedulePolicy& schedu
     clockExecutionModel(*this),
     executors(_executors),
     numberOfExecutors(executorNumber),
-    freeExecutors(nullptr)
+    freeExecutors(nullptr),
+    timerWaiter(nullptr)
 {
 }
 
@@ -160,6 +220,7 @@ Tasking::SchedulerExecutionModel::startExecutors(void)
     // Start the executor threads
     for (unsigned int i = 0; i < numberOfExecutors; ++i)
     {
+        executors[i].index = i;
         executors[i].startExecutor(*this);
         // Hang in free list after start
         executors[i].nextFree = freeExecutors;
@@ -185,8 +246,17 @@ Tasking::SchedulerExecutionModel::signal(void)
     Executor* executor = freeExecutors;
     if (executor != nullptr)
     {
-        // One executor is free, remove them from list of free executors and signal them for execution
+        // One executor is free, remove them from list of free executors
         freeExecutors = executor->nextFree;
+    }
+    else
+    {
+        // The timer waiter is also idle. It handles the work when no other executor is free.
+        executor = timerWaiter;
+    }
+    if (executor != nullptr)
+    {
+        // Signal the executor for execution
         emptySignal.leave();
         executor->signaler.enter();
         executor->signaler.signal();
@@ -215,6 +285,11 @@ Tasking::SchedulerExecutionModel::waitUntilEmpty(void)
     {
         --numberOfOccupiedExecutors;
     }
+    // The timer waiter is also not occupied
+    if (timerWaiter != nullptr)
+    {
+        --numberOfOccupiedExecutors;
+    }
     // Remaining executors are occupied, wait on a signal from them until all signal free.
     while (numberOfOccupiedExecutors > 0u)
     {
@@ -224,3 +299,58 @@ Tasking::SchedulerExecutionModel::waitUntilEmpty(void)
     // All events in the clock queue and tasks in the run queue are performed now
     emptySignal.leave();
 }
+
+// ----------------
+
+unsigned int
+Tasking::SchedulerExecutionModel::countFreeExecutors(void) const
+{
+    unsigned int numberOfFreeExecutors = 0u;
+    for (Executor* executor = freeExecutors; executor != nullptr; executor = executor->nextFree)
+    {
+        ++numberOfFreeExecutors;
+    }
+    return numberOfFreeExecutors;
+}
+
+// ----------------
+
+void
+Tasking::SchedulerExecutionModel::wakeUpTimerWaiter(void)
+{
+    emptySignal.enter();
+    Executor* executor = timerWaiter;
+    emptySignal.leave();
+    if (executor != nullptr)
+    {
+        // The timer waiter computes its wake up time again. If it has given up the role in between, the signal leads
+        // only to an additional cycle of the executor.
+        executor->signaler.enter();
+        executor->signaler.signal();
+        executor->signaler.leave();
+    }
+    else
+    {
+        // An idle executor becomes the timer waiter when it goes to sleep again
+        signal();
+    }
+}
+
+#ifdef TASKING_VIRTUAL_CLOCK
+// ----------------
+
+void
+Tasking::SchedulerExecutionModel::runUntil(Time time)
+{
+    clockExecutionModel.setHorizon(time);
+    // Wake up an executor. When it gets idle as last executor, the virtual time advances.
+    signal();
+    // Wait until the horizon is reached and all executors are idle
+    emptySignal.enter();
+    while ((countFreeExecutors() < numberOfExecutors) || (clockExecutionModel.getTime() < time))
+    {
+        emptySignal.wait();
+    }
+    emptySignal.leave();
+}
+#endif
@@ -22,6 +22,9 @@
 #include <scheduler.h>
 #include "signaler.h"
 #include "clockExecutionModel.h"
+#include "monotonicClockExecutionModel.h"
+#include "executorClockExecutionModel.h"
+#include "virtualClockExecutionModel.h"
 
 namespace Tasking
 {
@@ -31,6 +34,8 @@ class SchedulerExecutionModel : public Scheduler
 {
     friend void* executorThread(void*);
     friend void* clockThread(void*);
+    friend void* monotonicClockThread(void*);
+    friend class ExecutorClockExecutionModel;
 
 public:
     // Encapsulation of a POSIX thread as executor for the Tasking framework.
@@ -60,6 +65,9 @@ public:
         /// Point to the associated implementation of the scheduler.
         SchedulerImpl* schedulerImpl;
 
+        /// Index of the executor in the scheduler. It is handed over to the policy when the next task is requested.
+        unsigned int index;
+
         /// Flag to indicate the thread is running. Setting to false will terminate the thread.
         bool running;
 
@@ -94,6 +102,17 @@ public:
      */
     void setZeroTime(Time offset) override;
 
+#ifdef TASKING_VIRTUAL_CLOCK
+    /**
+     * Run the scheduler in virtual time until a time is reached. Whenever all executors are idle, the virtual time
+     * advances to the next event. The method returns when the time has reached the given time and all executors are
+     * idle. Only available when the framework is build with TASKING_VIRTUAL_CLOCK.
+     *
+     * @param time Absolute virtual time up to which the scheduler runs.
+     */
+    void runUntil(Time time);
+#endif
+
 protected:
     /** Start the executors. SchedulerExecutionModel is base class of provider and executors are child of provider.
      * Can not started earlier.
@@ -112,8 +131,28 @@ protected:
      */
     void waitUntilEmpty(void) override;
 
+    /**
+     * Wake up the timer waiter to wait on a new first event of the clock. If there is no timer waiter, an idle
+     * executor is woken up to become the timer waiter.
+     */
+    void wakeUpTimerWaiter(void);
+
+    /**
+     * Count the executors in the list of free executors. Call it only inside the protected area of the empty signal.
+     * @return Number of free executors.
+     */
+    unsigned int countFreeExecutors(void) const;
+
     /// The used clock execution model.
+#if defined(TASKING_VIRTUAL_CLOCK)
+    VirtualClockExecutionModel clockExecutionModel;
+#elif defined(TASKING_EXECUTOR_CLOCK)
+    ExecutorClockExecutionModel clockExecutionModel;
+#elif defined(TASKING_MONOTONIC_CLOCK)
+    MonotonicClockExecutionModel clockExecutionModel;
+#else
     ClockExecutionModel clockExecutionModel;
+#endif
 
     /// Pointer to the executors.
     Executor* executors;
@@ -126,6 +165,12 @@ protected:
 
     /// Index to the first free executor or -1 if all occupied.
     Executor* freeExecutors;
+
+    /**
+     * Idle executor which waits on the next event of the clock, or nullptr if no executor waits. The timer waiter is
+     * not in the list of free executors. Only used with the executor clock.
+     */
+    Executor* timerWaiter;
 };
 
 } // namespace Tasking
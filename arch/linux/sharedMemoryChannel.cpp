@@ -0,0 +1,247 @@
+/*
+ * sharedMemoryChannel.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "sharedMemoryChannel.h"
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Indices in shared memory need lock-free atomics without a lock object");
+
+namespace
+{
+/// Size of a cache line, the indices of producer and consumer are placed in different cache lines.
+const size_t cacheLineSize = 64u;
+
+/// Identification of an initialized header
+const uint32_t headerMagic = 0x54534852u;
+} // namespace
+
+/// Management data at the start of the segment. Producer and consumer index count the elements since creation.
+struct Tasking::SharedMemoryRing::Header
+{
+    /// Index of the next element to write, only written by the producer.
+    std::atomic<uint64_t> tail;
+    /// Padding to place the head in another cache line than the tail
+    char tailPadding[cacheLineSize - sizeof(std::atomic<uint64_t>)];
+    /// Index of the next element to read, only written by the consumer.
+    std::atomic<uint64_t> head;
+    /// Not zero when the consumer found the ring empty and waits for the doorbell, cleared by the producer.
+    std::atomic<uint64_t> waiting;
+    /// Padding to place the layout in another cache line than the head
+    char headPadding[cacheLineSize - (2u * sizeof(std::atomic<uint64_t>))];
+    /// Identification of an initialized header
+    uint32_t magic;
+    /// Size of one element, checked when a ring attaches
+    uint32_t elementSize;
+    /// Number of elements, checked when a ring attaches
+    uint32_t numberOfElements;
+    /// Padding to place the elements in another cache line than the layout
+    char layoutPadding[cacheLineSize - (3u * sizeof(uint32_t))];
+};
+
+// ----------------
+
+Tasking::SharedMemoryRing::SharedMemoryRing(size_t p_elementSize, unsigned int p_numberOfElements) :
+    header(nullptr),
+    elements(nullptr),
+    elementSize(p_elementSize),
+    numberOfElements(p_numberOfElements),
+    mappedSize(sizeof(Header) + (p_elementSize * p_numberOfElements)),
+    memoryFd(memfd_create("tasking", 0u)),
+    doorbellFd(eventfd(0u, EFD_NONBLOCK)),
+    cachedHead(0u),
+    cachedTail(0u)
+{
+    // The descriptors are inherited by a forked process, so they are not closed on exec
+    if ((memoryFd >= 0) && (ftruncate(memoryFd, static_cast<off_t>(mappedSize)) == 0))
+    {
+        map(true);
+    }
+}
+
+// ----------------
+
+Tasking::SharedMemoryRing::SharedMemoryRing(int p_memoryFd, int p_doorbellFd, size_t p_elementSize,
+                                            unsigned int p_numberOfElements) :
+    header(nullptr),
+    elements(nullptr),
+    elementSize(p_elementSize),
+    numberOfElements(p_numberOfElements),
+    mappedSize(sizeof(Header) + (p_elementSize * p_numberOfElements)),
+    memoryFd(dup(p_memoryFd)),
+    doorbellFd(dup(p_doorbellFd)),
+    cachedHead(0u),
+    cachedTail(0u)
+{
+    if (memoryFd >= 0)
+    {
+        map(false);
+    }
+}
+
+// ----------------
+
+Tasking::SharedMemoryRing::~SharedMemoryRing(void)
+{
+    if (header != nullptr)
+    {
+        munmap(header, mappedSize);
+    }
+    if (memoryFd >= 0)
+    {
+        close(memoryFd);
+    }
+    if (doorbellFd >= 0)
+    {
+        close(doorbellFd);
+    }
+}
+
+// ----------------
+
+void
+Tasking::SharedMemoryRing::map(bool initialize)
+{
+    assert((numberOfElements > 0u) && ((numberOfElements & (numberOfElements - 1u)) == 0u));
+    void* segment = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, memoryFd, 0);
+    if ((segment != MAP_FAILED) && (doorbellFd >= 0))
+    {
+        Header* segmentHeader = static_cast<Header*>(segment);
+        if (initialize)
+        {
+            // A new memfd is filled with zeros, so both indices are already zero. The consumer starts waiting.
+            segmentHeader->waiting.store(1u, std::memory_order_relaxed);
+            segmentHeader->elementSize = static_cast<uint32_t>(elementSize);
+            segmentHeader->numberOfElements = numberOfElements;
+            segmentHeader->magic = headerMagic;
+        }
+        // An attached ring is only valid when the layout of the creator matches
+        if ((segmentHeader->magic == headerMagic) && (segmentHeader->elementSize == elementSize)
+            && (segmentHeader->numberOfElements == numberOfElements))
+        {
+            header = segmentHeader;
+            elements = static_cast<char*>(segment) + sizeof(Header);
+            cachedHead = header->head.load(std::memory_order_acquire);
+            cachedTail = header->tail.load(std::memory_order_acquire);
+        }
+        else
+        {
+            munmap(segment, mappedSize);
+        }
+    }
+    else if (segment != MAP_FAILED)
+    {
+        munmap(segment, mappedSize);
+    }
+}
+
+// ----------------
+
+bool
+Tasking::SharedMemoryRing::isEmpty(void) const
+{
+    bool result = true;
+    if (header != nullptr)
+    {
+        result = header->head.load(std::memory_order_acquire) == header->tail.load(std::memory_order_acquire);
+    }
+    return result;
+}
+
+// ----------------
+
+void*
+Tasking::SharedMemoryRing::allocate(void)
+{
+    void* result = nullptr;
+    if (header != nullptr)
+    {
+        const uint64_t tail = header->tail.load(std::memory_order_relaxed);
+        // Read the index of the consumer only when the ring seems to be full
+        if ((tail - cachedHead) == numberOfElements)
+        {
+            cachedHead = header->head.load(std::memory_order_acquire);
+        }
+        if ((tail - cachedHead) != numberOfElements)
+        {
+            result = elements + (elementSize * (tail & (numberOfElements - 1u)));
+        }
+    }
+    return result;
+}
+
+// ----------------
+
+void
+Tasking::SharedMemoryRing::publish(void)
+{
+    assert(header != nullptr);
+    // Publish the element before the flag of the consumer is read. Both accesses are sequentially consistent, so
+    // either the consumer sees the element or the producer sees the waiting consumer.
+    header->tail.fetch_add(1u, std::memory_order_seq_cst);
+    // Ring the doorbell only once for a waiting consumer, further elements are found by the consumer without a ring
+    if ((header->waiting.load(std::memory_order_seq_cst) != 0u) && (header->waiting.exchange(0u) != 0u))
+    {
+        uint64_t ring = 1u;
+        ssize_t written = write(doorbellFd, &ring, sizeof(ring));
+        (void)written;
+    }
+}
+
+// ----------------
+
+const void*
+Tasking::SharedMemoryRing::front(void)
+{
+    const void* result = nullptr;
+    if (header != nullptr)
+    {
+        const uint64_t head = header->head.load(std::memory_order_relaxed);
+        if (head == cachedTail)
+        {
+            // Announce the wait and clear the doorbell before the index of the producer is read again. An element
+            // published after the read sees the waiting consumer and rings the doorbell again, so no wake up is lost.
+            header->waiting.store(1u, std::memory_order_seq_cst);
+            uint64_t rings;
+            ssize_t received = read(doorbellFd, &rings, sizeof(rings));
+            (void)received;
+            cachedTail = header->tail.load(std::memory_order_seq_cst);
+            if (head != cachedTail)
+            {
+                // The ring is not empty, so no doorbell is needed
+                header->waiting.store(0u, std::memory_order_relaxed);
+            }
+        }
+        if (head != cachedTail)
+        {
+            result = elements + (elementSize * (head & (numberOfElements - 1u)));
+        }
+    }
+    return result;
+}
+
+// ----------------
+
+void
+Tasking::SharedMemoryRing::release(void)
+{
+    assert(header != nullptr);
+    header->head.fetch_add(1u, std::memory_order_release);
+}
@@ -0,0 +1,391 @@
+/*
+ * sharedMemoryChannel.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_ARCH_LINUX_SHAREDMEMORYCHANNEL_H_
+#define TASKING_ARCH_LINUX_SHAREDMEMORYCHANNEL_H_
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+#include "fdChannel.h"
+
+namespace Tasking
+{
+
+/**
+ * Lock-free ring of elements for one producer and one consumer in a shared memory segment, which can be mapped by
+ * different processes. The segment is a memfd and the consumer is woken up by an eventfd, the doorbell. Both
+ * descriptors are passed to the other process, e.g. by inheritance at fork or over a unix domain socket, and the
+ * other process attaches its ring to them. The elements are read and written in place, so no serialization is needed.
+ *
+ * Application developers should use SharedMemorySender and SharedMemoryReceiver instead of this class.
+ *
+ * @see SharedMemorySender
+ * @see SharedMemoryReceiver
+ */
+class SharedMemoryRing
+{
+public:
+    /**
+     * Create a new shared memory segment and doorbell with an empty ring.
+     * @param elementSize Size of one element in bytes.
+     * @param numberOfElements Number of elements in the ring. It must be a power of two.
+     */
+    SharedMemoryRing(size_t elementSize, unsigned int numberOfElements);
+
+    /**
+     * Attach to the ring of a segment created by another ring. The descriptors are duplicated, the caller keeps the
+     * ownership of the given ones.
+     * @param memoryFd File descriptor of the shared memory segment.
+     * @param doorbellFd File descriptor of the eventfd doorbell.
+     * @param elementSize Size of one element in bytes, it shall match the size of the creator.
+     * @param numberOfElements Number of elements in the ring, it shall match the number of the creator.
+     */
+    SharedMemoryRing(int memoryFd, int doorbellFd, size_t elementSize, unsigned int numberOfElements);
+
+    /// Unmap the segment and close the descriptors of this process.
+    ~SharedMemoryRing(void);
+
+    // Disabling copy constructor
+    SharedMemoryRing(const SharedMemoryRing&) = delete;
+    // Disabling assignment operator
+    SharedMemoryRing& operator=(const SharedMemoryRing&) = delete;
+
+    /// @return True when the segment is mapped and matches the element size and number of elements.
+    bool isValid(void) const;
+
+    /// @return File descriptor of the shared memory segment to pass to the other process.
+    int getMemoryFd(void) const;
+
+    /// @return File descriptor of the doorbell to pass to the other process.
+    int getDoorbellFd(void) const;
+
+    /// @return True if the ring has no element to read.
+    bool isEmpty(void) const;
+
+    /**
+     * Get the slot of the next element to write. Only called by the producer.
+     * @return Pointer to the slot in the shared memory or nullptr if the ring is full or not valid.
+     */
+    void* allocate(void);
+
+    /**
+     * Publish the slot provided by allocate to the consumer. The doorbell rings only when the consumer waits, i.e. it
+     * found the ring empty before. Only called by the producer.
+     */
+    void publish(void);
+
+    /**
+     * Get the oldest element. Only called by the consumer. When the ring is empty the consumer marks itself as
+     * waiting and the doorbell is cleared, so the consumer is woken up by the next publish.
+     * @return Pointer to the element in the shared memory or nullptr if the ring is empty.
+     */
+    const void* front(void);
+
+    /// Free the element provided by front for the producer. Only called by the consumer.
+    void release(void);
+
+protected:
+    /// Management data at the start of the segment
+    struct Header;
+
+    /// Map the segment and check or initialize the header.
+    void map(bool initialize);
+
+    /// Header in the shared memory segment
+    Header* header;
+
+    /// Start of the elements in the shared memory segment
+    char* elements;
+
+    /// Size of one element
+    const size_t elementSize;
+
+    /// Number of elements in the ring
+    const unsigned int numberOfElements;
+
+    /// Size of the mapped segment
+    size_t mappedSize;
+
+    /// File descriptor of the shared memory segment
+    int memoryFd;
+
+    /// File descriptor of the eventfd doorbell
+    int doorbellFd;
+
+    /// Last read value of the consumer index by the producer
+    uint64_t cachedHead;
+
+    /// Last read value of the producer index by the consumer
+    uint64_t cachedTail;
+};
+
+/**
+ * Sending side of a shared memory channel to a task in another process. Elements are written in place into the
+ * shared memory and the receiver is woken up by the doorbell. Only one task shall send at the same time.
+ *
+ * @tparam T Data type of the elements. The type shall be trivially copyable, because it is read in place by another
+ * process.
+ * @tparam size Number of elements in the ring. It must be a power of two.
+ */
+template<typename T, size_t size>
+class SharedMemorySender
+{
+public:
+    /// Create a new shared memory segment and doorbell.
+    SharedMemorySender(void);
+
+    /**
+     * Attach to the segment created by a receiver.
+     * @param memoryFd File descriptor of the shared memory segment.
+     * @param doorbellFd File descriptor of the doorbell.
+     */
+    SharedMemorySender(int memoryFd, int doorbellFd);
+
+    /**
+     * Copy data into the ring and wake up the receiver.
+     * @param data Data to send.
+     * @return True if the data is sent, false if the ring is full.
+     */
+    bool push(const T& data);
+
+    /**
+     * Get the slot of the next element to fill it in place without a copy. The slot is sent by publish.
+     * @return Pointer to the slot or nullptr if the ring is full.
+     */
+    T* allocate(void);
+
+    /// Send the slot provided by allocate and wake up the receiver, if it waits for an element.
+    void publish(void);
+
+    /// @return True when the segment is mapped and matches the element type and size.
+    bool isValid(void) const;
+
+    /// @return File descriptor of the shared memory segment to pass to the receiving process.
+    int getMemoryFd(void) const;
+
+    /// @return File descriptor of the doorbell to pass to the receiving process.
+    int getDoorbellFd(void) const;
+
+protected:
+    /// Ring in the shared memory
+    SharedMemoryRing ring;
+};
+
+/**
+ * Receiving side of a shared memory channel. The channel is pushed by a reactor when the doorbell rings, so the
+ * connected tasks are activated as if the sender were a local task. Call arm after the inputs are connected, like
+ * for a file descriptor channel. The connected task shall pop until no element is left, the doorbell rings only for
+ * the first element sent after the ring was found empty.
+ *
+ * @tparam T Data type of the elements. The type shall be trivially copyable.
+ * @tparam size Number of elements in the ring. It must be a power of two.
+ */
+template<typename T, size_t size>
+class SharedMemoryReceiver : protected SharedMemoryRing, public FdChannel
+{
+public:
+    /**
+     * Create a new shared memory segment and doorbell.
+     * @param reactor Reactor which waits on the doorbell.
+     * @param channelId Identification of the channel.
+     */
+    SharedMemoryReceiver(Reactor& reactor, ChannelId channelId = 0);
+
+    /**
+     * Attach to the segment created by a sender.
+     * @param reactor Reactor which waits on the doorbell.
+     * @param memoryFd File descriptor of the shared memory segment.
+     * @param doorbellFd File descriptor of the doorbell.
+     * @param channelId Identification of the channel.
+     */
+    SharedMemoryReceiver(Reactor& reactor, int memoryFd, int doorbellFd, ChannelId channelId = 0);
+
+    /**
+     * Copy the oldest element out of the ring.
+     * @param data [out] Reference to copy the element to.
+     * @return True if an element is taken, false if the ring is empty.
+     */
+    bool pop(T& data);
+
+    /**
+     * Get the oldest element to read it in place without a copy. The element is freed by release.
+     * @return Pointer to the element in the shared memory or nullptr if the ring is empty.
+     */
+    const T* front(void);
+
+    using SharedMemoryRing::getDoorbellFd;
+    using SharedMemoryRing::getMemoryFd;
+    using SharedMemoryRing::isEmpty;
+    using SharedMemoryRing::isValid;
+    using SharedMemoryRing::release;
+};
+
+} // namespace Tasking
+
+// ----------- inlines -----------
+
+inline bool
+Tasking::SharedMemoryRing::isValid(void) const
+{
+    return header != nullptr;
+}
+
+// ----------------
+
+inline int
+Tasking::SharedMemoryRing::getMemoryFd(void) const
+{
+    return memoryFd;
+}
+
+// ----------------
+
+inline int
+Tasking::SharedMemoryRing::getDoorbellFd(void) const
+{
+    return doorbellFd;
+}
+
+// ----------------
+
+template<typename T, size_t size>
+Tasking::SharedMemorySender<T, size>::SharedMemorySender(void) : ring(sizeof(T), size)
+{
+    static_assert((size > 0u) && ((size & (size - 1u)) == 0u), "Size of the ring must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "Type needs to be trivially copyable");
+}
+
+// ----------------
+
+template<typename T, size_t size>
+Tasking::SharedMemorySender<T, size>::SharedMemorySender(int memoryFd, int doorbellFd) :
+    ring(memoryFd, doorbellFd, sizeof(T), size)
+{
+    static_assert((size > 0u) && ((size & (size - 1u)) == 0u), "Size of the ring must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "Type needs to be trivially copyable");
+}
+
+// ----------------
+
+template<typename T, size_t size>
+bool
+Tasking::SharedMemorySender<T, size>::push(const T& data)
+{
+    T* slot = allocate();
+    if (slot != nullptr)
+    {
+        *slot = data;
+        ring.publish();
+    }
+    return slot != nullptr;
+}
+
+// ----------------
+
+template<typename T, size_t size>
+T*
+Tasking::SharedMemorySender<T, size>::allocate(void)
+{
+    return static_cast<T*>(ring.allocate());
+}
+
+// ----------------
+
+template<typename T, size_t size>
+void
+Tasking::SharedMemorySender<T, size>::publish(void)
+{
+    ring.publish();
+}
+
+// ----------------
+
+template<typename T, size_t size>
+bool
+Tasking::SharedMemorySender<T, size>::isValid(void) const
+{
+    return ring.isValid();
+}
+
+// ----------------
+
+template<typename T, size_t size>
+int
+Tasking::SharedMemorySender<T, size>::getMemoryFd(void) const
+{
+    return ring.getMemoryFd();
+}
+
+// ----------------
+
+template<typename T, size_t size>
+int
+Tasking::SharedMemorySender<T, size>::getDoorbellFd(void) const
+{
+    return ring.getDoorbellFd();
+}
+
+// ----------------
+
+template<typename T, size_t size>
+Tasking::SharedMemoryReceiver<T, size>::SharedMemoryReceiver(Reactor& p_reactor, ChannelId channelId) :
+    SharedMemoryRing(sizeof(T), size), FdChannel(p_reactor, SharedMemoryRing::getDoorbellFd(), readable, channelId)
+{
+    static_assert((size > 0u) && ((size & (size - 1u)) == 0u), "Size of the ring must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "Type needs to be trivially copyable");
+}
+
+// ----------------
+
+template<typename T, size_t size>
+Tasking::SharedMemoryReceiver<T, size>::SharedMemoryReceiver(Reactor& p_reactor, int p_memoryFd, int p_doorbellFd,
+                                                             ChannelId channelId) :
+    SharedMemoryRing(p_memoryFd, p_doorbellFd, sizeof(T), size),
+    FdChannel(p_reactor, SharedMemoryRing::getDoorbellFd(), readable, channelId)
+{
+    static_assert((size > 0u) && ((size & (size - 1u)) == 0u), "Size of the ring must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "Type needs to be trivially copyable");
+}
+
+// ----------------
+
+template<typename T, size_t size>
+bool
+Tasking::SharedMemoryReceiver<T, size>::pop(T& data)
+{
+    const T* element = front();
+    if (element != nullptr)
+    {
+        data = *element;
+        release();
+    }
+    return element != nullptr;
+}
+
+// ----------------
+
+template<typename T, size_t size>
+const T*
+Tasking::SharedMemoryReceiver<T, size>::front(void)
+{
+    return static_cast<const T*>(SharedMemoryRing::front());
+}
+
+#endif /* TASKING_ARCH_LINUX_SHAREDMEMORYCHANNEL_H_ */
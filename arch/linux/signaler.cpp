@@ -17,13 +17,19 @@
  */
 
 #include <cassert>
+#include <cerrno>
 #include "signaler.h"
 
 Tasking::Signaler::Signaler(void) : wakeUp(false)
 {
-    int success;
-    success = pthread_cond_init(&blockCond, nullptr);
+    // Timed waits are measured with the monotonic clock
+    pthread_condattr_t attributes;
+    int success = pthread_condattr_init(&attributes);
+    success |= pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    success |= pthread_cond_init(&blockCond, &attributes);
+    success |= pthread_condattr_destroy(&attributes);
     assert(success == 0);
+    (void)success;
 }
 
 // ----------------
@@ -47,6 +53,19 @@ Tasking::Signaler::wait()
 
 // ----------------
 
+void
+Tasking::Signaler::waitUntil(const struct timespec& wakeUpTime)
+{
+    int result = 0;
+    while (!wakeUp && (result != ETIMEDOUT))
+    {
+        result = pthread_cond_timedwait(&blockCond, &blockMutex, &wakeUpTime);
+    }
+    wakeUp = false;
+}
+
+// ----------------
+
 void
 Tasking::Signaler::signal(void)
 {
@@ -19,6 +19,7 @@
 #ifndef TASKING_INCLUDE_ARCH_LINUX_SIGNALER_H_
 #define TASKING_INCLUDE_ARCH_LINUX_SIGNALER_H_
 
+#include <time.h>
 #include "mutexImpl.h"
 
 namespace Tasking
@@ -41,6 +42,14 @@ public:
      */
     void wait(void);
 
+    /**
+     * Wait like wait, but wake up latest at an absolute time. The method should only called after the signaler is
+     * locked.
+     * @param wakeUpTime Absolute time of CLOCK_MONOTONIC to wake up if no signal is given.
+     * @see wait
+     */
+    void waitUntil(const struct timespec& wakeUpTime);
+
     /**
      * Give the signal to the signaler. One of the threads which has called wait will wake up, other still sleeping.
      * Signal the POSIX pthread conditional variable. When the call returns the wake up flag is true until the waiting
@@ -0,0 +1,115 @@
+/*
+ * timeSource.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <time.h>
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#include "timeSource.h"
+
+Tasking::TimeSource::TimeSource(void) : useTsc(false), tscBase(0u), nanosecondsBase(0u), multiplier(0u)
+{
+#if defined(__x86_64__)
+    if (hasInvariantTsc())
+    {
+        // Measure the TSC ticks over a sleep of ten milliseconds of CLOCK_MONOTONIC
+        uint64_t startTsc = readTsc();
+        uint64_t startNanoseconds = readMonotonic();
+        struct timespec sleepTime = {0, 10000000};
+        nanosleep(&sleepTime, nullptr);
+        tscBase = readTsc();
+        nanosecondsBase = readMonotonic();
+        uint64_t ticks = tscBase - startTsc;
+        if (ticks > 0u)
+        {
+            multiplier = static_cast<uint64_t>(
+                (static_cast<unsigned __int128>(nanosecondsBase - startNanoseconds) << shift) / ticks);
+            useTsc = true;
+        }
+    }
+#endif
+}
+
+// ----------------
+
+uint64_t
+Tasking::TimeSource::getNanoseconds(void) const
+{
+    uint64_t nanoseconds;
+#if defined(__x86_64__)
+    if (useTsc)
+    {
+        // Scale the ticks since the calibration without a division
+        unsigned __int128 scaled = static_cast<unsigned __int128>(readTsc() - tscBase) * multiplier;
+        nanoseconds = nanosecondsBase + static_cast<uint64_t>(scaled >> shift);
+    }
+    else
+#endif
+    {
+        nanoseconds = readMonotonic();
+    }
+    return nanoseconds;
+}
+
+// ----------------
+
+bool
+Tasking::TimeSource::isTscUsed(void) const
+{
+    return useTsc;
+}
+
+// ----------------
+
+bool
+Tasking::TimeSource::hasInvariantTsc(void)
+{
+    bool invariant = false;
+#if defined(__x86_64__)
+    // The invariant TSC is reported by bit 8 of EDX of the extended leaf 0x80000007
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx))
+    {
+        invariant = (edx & (1u << 8)) != 0u;
+    }
+#endif
+    return invariant;
+}
+
+// ----------------
+
+uint64_t
+Tasking::TimeSource::readTsc(void)
+{
+#if defined(__x86_64__)
+    return __rdtsc();
+#else
+    return 0u;
+#endif
+}
+
+// ----------------
+
+uint64_t
+Tasking::TimeSource::readMonotonic(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000u + static_cast<uint64_t>(now.tv_nsec);
+}
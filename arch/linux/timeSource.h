@@ -0,0 +1,81 @@
+/*
+ * timeSource.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_ARCH_LINUX_TIMESOURCE_H_
+#define TASKING_ARCH_LINUX_TIMESOURCE_H_
+
+#include <stdint.h>
+
+namespace Tasking
+{
+
+/**
+ * Monotonic time source with low overhead per call. On x86-64 processors with an invariant time stamp counter (TSC) the
+ * counter is read directly and converted to nanoseconds with a multiplication and a shift. The conversion is
+ * calibrated against CLOCK_MONOTONIC at construction. Without an invariant TSC the time is read by clock_gettime with
+ * CLOCK_MONOTONIC, which is served by the vDSO without a system call.
+ *
+ * The calibration over ten milliseconds determines the rate of the TSC with an error of about 10 to 100 ppm. The time
+ * source drifts by this rate against CLOCK_MONOTONIC, which is about 36 to 360 milliseconds per hour and is not
+ * corrected after the calibration. So the time source should only be used where such a drift is harmless, e.g. by a clock which
+ * waits for relative time spans, and not to compare time stamps with CLOCK_MONOTONIC over a long run.
+ */
+class TimeSource
+{
+public:
+    /**
+     * Check for an invariant TSC and calibrate it against CLOCK_MONOTONIC. The calibration takes about ten
+     * milliseconds.
+     */
+    TimeSource(void);
+
+    /// @return Monotonic time in nanoseconds.
+    uint64_t getNanoseconds(void) const;
+
+    /// @return True when the time is computed from the TSC, false if CLOCK_MONOTONIC is used.
+    bool isTscUsed(void) const;
+
+protected:
+    /// @return True when the processor provides an invariant TSC.
+    static bool hasInvariantTsc(void);
+
+    /// @return Current value of the TSC, or zero without TSC.
+    static uint64_t readTsc(void);
+
+    /// @return Current time of CLOCK_MONOTONIC in nanoseconds.
+    static uint64_t readMonotonic(void);
+
+    /// Number of fractional bits of the multiplier
+    static const unsigned int shift = 32u;
+
+    /// True when the TSC is used
+    bool useTsc;
+
+    /// TSC value at the end of the calibration
+    uint64_t tscBase;
+
+    /// Monotonic time in nanoseconds at the end of the calibration
+    uint64_t nanosecondsBase;
+
+    /// Nanoseconds per TSC tick as fixed point value with shift fractional bits
+    uint64_t multiplier;
+};
+
+} // namespace Tasking
+
+#endif /* TASKING_ARCH_LINUX_TIMESOURCE_H_ */
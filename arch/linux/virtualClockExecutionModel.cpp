@@ -0,0 +1,85 @@
+/*
+ * virtualClockExecutionModel.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "schedulerExecutionModel.h"
+#include "taskTypes.h"
+
+Tasking::VirtualClockExecutionModel::VirtualClockExecutionModel(Scheduler& p_scheduler) :
+    Clock(p_scheduler), now(0u), horizon(0u)
+{
+}
+
+// ----------------
+
+Tasking::Time
+Tasking::VirtualClockExecutionModel::getTime(void) const
+{
+    MutexGuard guard(timeMutex);
+    return now;
+}
+
+// ----------------
+
+void
+Tasking::VirtualClockExecutionModel::setZeroTime(Tasking::Time offset)
+{
+    MutexGuard guard(timeMutex);
+    now = offset;
+}
+
+// ----------------
+
+void
+Tasking::VirtualClockExecutionModel::setHorizon(Tasking::Time time)
+{
+    MutexGuard guard(timeMutex);
+    horizon = time;
+}
+
+// ----------------
+
+bool
+Tasking::VirtualClockExecutionModel::advance(void)
+{
+    MutexGuard queueGuard(timeQueueMutex);
+    Time headTime = getHeadTime();
+    MutexGuard guard(timeMutex);
+    bool pending = false;
+    if ((headTime != 0u) && (headTime <= horizon))
+    {
+        // Jump to the next event. An event in the past is pending without a change of the time.
+        if (headTime > now)
+        {
+            now = headTime;
+        }
+        pending = true;
+    }
+    else if (horizon > now)
+    {
+        // No event up to the horizon, the time passes until the horizon
+        now = horizon;
+    }
+    return pending;
+}
+
+// ----------------
+
+void
+Tasking::VirtualClockExecutionModel::startTimer(Time)
+{
+}
@@ -0,0 +1,91 @@
+/*
+ * virtualClockExecutionModel.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_ARCH_LINUX_VIRTUALCLOCKEXECUTIONMODEL_H_
+#define TASKING_ARCH_LINUX_VIRTUALCLOCKEXECUTIONMODEL_H_
+
+#include <impl/clock_impl.h>
+
+namespace Tasking
+{
+
+/**
+ * Implementation of a clock execution model with a virtual time. The time does not follow a system clock, it stands
+ * still while tasks are executed and jumps to the activation time of the next event as soon as all executors of the
+ * scheduler are idle. So periodic scenarios of hours run in seconds, while the tasks are still executed by the real
+ * executor threads.
+ *
+ * The time advances only up to a horizon, which is set by SchedulerExecutionModel::runUntil. Before, the time stands
+ * at zero. Tasks activated by threads outside of the scheduler are only recognized when they are activated while
+ * the scheduler is not quiescent.
+ *
+ * The clock is used by the scheduler when the framework is build with TASKING_VIRTUAL_CLOCK, e.g. by the build option
+ * linuxClock = virtual.
+ */
+class VirtualClockExecutionModel : public Clock
+{
+public:
+    /**
+     * Initialize clock with time zero.
+     * @param scheduler Reference to the executor
+     */
+    VirtualClockExecutionModel(Scheduler& scheduler);
+
+    /// @return The current virtual time.
+    Time getTime(void) const override;
+
+    /**
+     * Method to set the zero time.
+     *
+     * @param offset The virtual time is set to this value. The time should not go back when events are queued.
+     */
+    void setZeroTime(Time offset);
+
+    /**
+     * Set the horizon up to which the virtual time may advance.
+     * @param time Absolute virtual time of the horizon.
+     */
+    void setHorizon(Time time);
+
+    /**
+     * Advance the virtual time to the activation time of the first event in the clock queue. If the event is behind
+     * the horizon, the time advances to the horizon. Call it only when the scheduler is quiescent.
+     * @return True when an event is pending after the advance, false if the horizon is reached.
+     */
+    bool advance(void);
+
+protected:
+    /**
+     * Nothing to do, the timer expires when the scheduler gets quiescent and the time advances.
+     * @param timeSpan The time after which the timer shall expire.
+     */
+    void startTimer(Time timeSpan) override;
+
+    /// Mutex to protect the virtual time. The time is also read inside the protected area of the timeQueueMutex.
+    mutable Mutex timeMutex;
+
+    /// The current virtual time
+    Time now;
+
+    /// Time up to which the virtual time advances
+    Time horizon;
+};
+
+} // namespace Tasking
+
+#endif /* TASKING_ARCH_LINUX_VIRTUALCLOCKEXECUTIONMODEL_H_ */
@@ -38,7 +38,7 @@ Tasking::ClockExecutionModel::~ClockExecutionModel(void)
 Tasking::Time
 Tasking::ClockExecutionModel::getTime(void) const
 {
-    return (boardClock.now() - m_zeroTime).milliseconds();
+    return fromMicroseconds((boardClock.now() - m_zeroTime).microseconds());
 }
 
 // ----------------
@@ -46,7 +46,7 @@ Tasking::ClockExecutionModel::getTime(void) const
 void
 Tasking::ClockExecutionModel::setZeroTime(Tasking::Time p_offset)
 {
-    outpost::time::Milliseconds offset(p_offset);
+    outpost::time::Microseconds offset(toNanoseconds(p_offset) / 1000u);
     m_zeroTime = boardClock.now() - offset;
 }
 
@@ -55,7 +55,7 @@ Tasking::ClockExecutionModel::setZeroTime(Tasking::Time p_offset)
 void
 Tasking::ClockExecutionModel::startTimer(Time timeSpan)
 {
-    outpost::time::Milliseconds wakeUpIn(timeSpan);
+    outpost::time::Microseconds wakeUpIn(toNanoseconds(timeSpan) / 1000u);
     m_timer.start(wakeUpIn);
 }
 
@@ -79,7 +79,7 @@ Tasking::ClockExecutionModel::clockTick(outpost::rtos::Timer* timer)
     if (nextStartTime != 0 && nextStartTime > currentTime)
     {
         Time nextGapTime = nextStartTime - currentTime;
-        outpost::time::Milliseconds wakeupIn(nextGapTime);
+        outpost::time::Microseconds wakeupIn(toNanoseconds(nextGapTime) / 1000u);
         timer->start(wakeupIn);
     }
 
@@ -41,7 +41,7 @@ public:
     ~ClockExecutionModel(void);
 
     /**
-     * @return Milliseconds since instantiation of the associated scheduler or since a new zero time was set.
+     * @return Time ticks since instantiation of the associated scheduler or since a new zero time was set.
      * @see setZeroTime
      */
     Time getTime(void) const override;
@@ -24,6 +24,7 @@ Tasking::SchedulerExecutionModel::Executor::Executor(void) :
     running(false),
     schedulerModel(nullptr),
     schedulerImpl(nullptr),
+    index(0u),
     nextFree(nullptr)
 {
 }
@@ -60,12 +61,16 @@ Tasking::SchedulerExecutionModel::Executor::run(void)
     running = true;
     schedulerModel->emptySignal.signal();
     schedulerModel->emptySignal.leave();
+    bool sleep = true;
 
     // Execute until running is set to false to signal termination of the framework
     while (true)
     {
         // Sleep until wake up from scheduler
-        signaler.wait();
+        if (sleep)
+        {
+            signaler.wait();
+        }
 
         // For task and event execution leave critical area to scheduler
         signaler.leave();
@@ -75,8 +80,8 @@ Tasking::SchedulerExecutionModel::Executor::run(void)
         {
             schedulerImpl->handleEvents();
         }
-        for (TaskImpl* task = schedulerImpl->policy.nextTask(); (task != nullptr);
-             task = schedulerImpl->policy.nextTask())
+        for (TaskImpl* task = schedulerImpl->policy.nextTaskFor(index); (task != nullptr);
+             task = schedulerImpl->policy.nextTaskFor(index))
         {
             // When an event is pending, perform them first.
             if (schedulerImpl->clock.isPending())
@@ -89,9 +94,15 @@ Tasking::SchedulerExecutionModel::Executor::run(void)
         // Enter into critical section to have synchronization on running flag and signaler wait.
         signaler.enter();
         schedulerModel->emptySignal.enter();
-        nextFree = schedulerModel->freeExecutors;
-        schedulerModel->freeExecutors = this;
-        schedulerModel->emptySignal.signal();
+        // An event getting pending after the last check is signaled while this executor is not in the free list, so
+        // the signal is lost. Continue without sleep in this case.
+        sleep = !schedulerImpl->clock.isPending();
+        if (sleep)
+        {
+            nextFree = schedulerModel->freeExecutors;
+            schedulerModel->freeExecutors = this;
+            schedulerModel->emptySignal.signal();
+        }
         schedulerModel->emptySignal.leave();
     } // end of execution loop
 
@@ -123,6 +134,7 @@ Tasking::SchedulerExecutionModel::startExecutors(void)
         // Start only if it is not started yet. The threads did not terminate.
         if (!executors[i].running)
         {
+            executors[i].index = i;
             executors[i].startExecutor(*this);
             // Wait on signal from started thread to prevent running conditions
             emptySignal.wait();
@@ -63,6 +63,9 @@ public:
         /// Point to the associated implementation of the scheduler.
         SchedulerImpl* schedulerImpl;
 
+        /// Index of the executor in the scheduler. It is handed over to the policy when the next task is requested.
+        unsigned int index;
+
         /// Pointer to the next free executor or a null pointer. The pointer is updated when the executor gets free.
         Executor* nextFree;
     };
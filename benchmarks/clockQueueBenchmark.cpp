@@ -0,0 +1,123 @@
+/*
+ * clockQueueBenchmark.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Compare the sorted list of the clock with the timing wheel as clock queue. Each event is used as a time out which is
+ * started, restarted once before it expires, and finally fired. The time for each phase is reported per event.
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include <clockTimingWheel.h>
+#include <schedulePolicyFifo.h>
+#include <schedulerUnitTest.h>
+#include <taskEvent.h>
+
+/// Longest time out in ms
+static const Tasking::Time maximumTimeOut = 10000u;
+
+/// The sorted list grows quadratic, larger numbers of events are only measured for the timing wheel.
+static const unsigned int maximumListEvents = 10000u;
+
+/// Simple linear congruential generator to have the same times for both queues.
+static unsigned int seed;
+
+static Tasking::Time
+randomTimeOut(void)
+{
+    seed = seed * 1103515245u + 12345u;
+    return 1u + ((seed >> 8u) % maximumTimeOut);
+}
+
+/// Time in ns per event since the start point.
+static double
+nsPerEvent(std::chrono::steady_clock::time_point start, unsigned int numberOfEvents)
+{
+    std::chrono::duration<double, std::nano> span = std::chrono::steady_clock::now() - start;
+    return span.count() / numberOfEvents;
+}
+
+/// Run the benchmark for a number of time outs with or without a timing wheel.
+static void
+benchmark(unsigned int numberOfEvents, bool useWheel)
+{
+    Tasking::SchedulePolicyFifo policy;
+    Tasking::SchedulerUnitTest scheduler(policy);
+    Tasking::ClockTimingWheel* wheel = nullptr;
+    if (useWheel)
+    {
+        wheel = new Tasking::ClockTimingWheel(scheduler);
+    }
+    Tasking::Event** events = new Tasking::Event*[numberOfEvents];
+    for (unsigned int i = 0; i < numberOfEvents; ++i)
+    {
+        events[i] = new Tasking::Event(scheduler);
+    }
+    scheduler.start();
+    seed = 42u;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < numberOfEvents; ++i)
+    {
+        events[i]->trigger(randomTimeOut());
+    }
+    double startTime = nsPerEvent(start, numberOfEvents);
+
+    // Restart is a stop and a new start of the event
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < numberOfEvents; ++i)
+    {
+        events[i]->trigger(randomTimeOut());
+    }
+    double restartTime = nsPerEvent(start, numberOfEvents);
+
+    start = std::chrono::steady_clock::now();
+    for (Tasking::Time time = 0u; time <= maximumTimeOut; time += 10u)
+    {
+        scheduler.schedule(10u);
+    }
+    double fireTime = nsPerEvent(start, numberOfEvents);
+
+    std::printf("%-6s %7u %12.1f %12.1f %12.1f\n", useWheel ? "wheel" : "list", numberOfEvents, startTime,
+                restartTime, fireTime);
+    std::fflush(stdout);
+
+    for (unsigned int i = 0; i < numberOfEvents; ++i)
+    {
+        delete events[i];
+    }
+    delete[] events;
+    delete wheel;
+}
+
+int
+main(void)
+{
+    const unsigned int sizes[] = {1000u, 10000u, 100000u};
+    std::printf("%-6s %7s %12s %12s %12s\n", "queue", "timers", "start ns", "restart ns", "fire ns");
+    for (unsigned int size : sizes)
+    {
+        if (size <= maximumListEvents)
+        {
+            benchmark(size, false);
+        }
+        benchmark(size, true);
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * eventBatchBenchmark.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measure the handling of periodic events which are all pending at the same tick. The unit test scheduler is used,
+ * so only the handling of the events by the scheduler and the clock queue is measured. The time is reported per fired
+ * event.
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include <schedulePolicyFifo.h>
+#include <schedulerUnitTest.h>
+#include <taskEvent.h>
+
+/// Number of handled ticks for each measurement
+static const unsigned int numberOfTicks = 1000u;
+
+/// Measure the handling of a number of periodic events which fire at each tick.
+static void
+benchmark(unsigned int numberOfEvents)
+{
+    Tasking::SchedulePolicyFifo policy;
+    Tasking::SchedulerUnitTest scheduler(policy);
+    Tasking::Event** events = new Tasking::Event*[numberOfEvents];
+    for (unsigned int i = 0; i < numberOfEvents; ++i)
+    {
+        events[i] = new Tasking::Event(scheduler);
+        events[i]->setPeriodicTiming(1u, 1u);
+    }
+    scheduler.start();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int tick = 0u; tick < numberOfTicks; ++tick)
+    {
+        scheduler.schedule(1u);
+    }
+    std::chrono::duration<double, std::nano> span = std::chrono::steady_clock::now() - start;
+
+    std::printf("%7u %12.1f\n", numberOfEvents, span.count() / (numberOfTicks * numberOfEvents));
+    std::fflush(stdout);
+
+    for (unsigned int i = 0; i < numberOfEvents; ++i)
+    {
+        delete events[i];
+    }
+    delete[] events;
+}
+
+int
+main(void)
+{
+    const unsigned int sizes[] = {10u, 100u, 500u, 2000u};
+    std::printf("%7s %12s\n", "events", "ns per event");
+    for (unsigned int size : sizes)
+    {
+        benchmark(size);
+    }
+    return 0;
+}
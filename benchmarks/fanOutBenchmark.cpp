@@ -0,0 +1,128 @@
+/*
+ * fanOutBenchmark.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measure the push of a channel to many task inputs. The inputs are notified once via the linked list of the inputs
+ * and once via the frozen fan-out storage of the channel. The tasks are allocated between other data, so the inputs
+ * are spread over the memory like in an application. The threshold of the inputs is not reached, so only the
+ * notification is measured. Synchronous inputs lock a mutex for each notification, asynchronous inputs show the cost
+ * of the access to the inputs. The time is reported per notified input.
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include <schedulePolicyFifo.h>
+#include <schedulerUnitTest.h>
+#include <task.h>
+#include <taskChannel.h>
+
+/// Number of pushes for each measurement
+static const unsigned int numberOfPushes = 10000u;
+
+/// Size of the data allocated between two tasks
+static const unsigned int spreadSize = 4096u;
+
+/// Channel with access to the push operation
+class FanOutChannel : public Tasking::Channel
+{
+public:
+    using Tasking::Channel::push;
+};
+
+/// Task which is not activated during the measurement
+class FanOutTask : public Tasking::TaskProvider<1u, Tasking::SchedulePolicyFifo>
+{
+public:
+    FanOutTask(Tasking::Scheduler& scheduler, Tasking::Channel& p_channel, bool synchron) :
+        TaskProvider(scheduler), channel(p_channel)
+    {
+        inputs[0].configure(numberOfPushes + 1u);
+        inputs[0].setSynchron(synchron);
+    }
+
+    void
+    initialize(void) override
+    {
+        configureInput(0u, channel);
+    }
+
+    void
+    execute(void) override
+    {
+    }
+
+    Tasking::Channel& channel;
+};
+
+/// Measure the pushes of a channel to a number of inputs with or without frozen fan-out.
+static double
+benchmark(unsigned int numberOfInputs, bool synchron, bool frozen)
+{
+    Tasking::SchedulePolicyFifo policy;
+    Tasking::SchedulerUnitTest scheduler(policy);
+    FanOutChannel channel;
+    Tasking::ChannelFanOutProvider<256u> fanOut;
+    if (frozen)
+    {
+        channel.setFanOut(fanOut);
+    }
+    FanOutTask** tasks = new FanOutTask*[numberOfInputs];
+    char** spreads = new char*[numberOfInputs];
+    for (unsigned int i = 0; i < numberOfInputs; ++i)
+    {
+        tasks[i] = new FanOutTask(scheduler, channel, synchron);
+        spreads[i] = new char[spreadSize];
+    }
+    scheduler.initialize();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int push = 0u; push < numberOfPushes; ++push)
+    {
+        channel.push();
+    }
+    std::chrono::duration<double, std::nano> span = std::chrono::steady_clock::now() - start;
+
+    for (unsigned int i = 0; i < numberOfInputs; ++i)
+    {
+        delete tasks[i];
+        delete[] spreads[i];
+    }
+    delete[] tasks;
+    delete[] spreads;
+    return span.count() / (numberOfPushes * numberOfInputs);
+}
+
+int
+main(void)
+{
+    const unsigned int sizes[] = {64u, 256u};
+    const bool modes[] = {false, true};
+    std::printf("%7s %12s %16s %16s\n", "inputs", "mode", "list ns/input", "frozen ns/input");
+    for (unsigned int size : sizes)
+    {
+        for (bool synchron : modes)
+        {
+            double list = benchmark(size, synchron, false);
+            double frozen = benchmark(size, synchron, true);
+            std::printf("%7u %12s %16.2f %16.2f\n", size, synchron ? "synchronous" : "asynchronous", list, frozen);
+            std::fflush(stdout);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * jitterBenchmark.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measure the activation jitter of a periodic task at 10 kHz. The tasking framework must be built with a time
+ * resolution of microseconds or nanoseconds, e.g. make benchmarks timeResolution=us. Each activation is time stamped
+ * with the steady clock of the system and compared to the ideal activation grid of the first activation.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+#include <schedulePolicyFifo.h>
+#include <schedulerProvider.h>
+#include <task.h>
+#include <taskEvent.h>
+
+/// Period of the control loop
+static const Tasking::Time period = Tasking::fromMicroseconds(100u);
+
+/// Number of measured activations, one second at 10 kHz
+static const unsigned int numberOfActivations = 10000u;
+
+/// Time stamps of the activations
+static std::chrono::steady_clock::time_point activations[numberOfActivations];
+
+/// Absolute jitter of each interval in ns
+static double jitter[numberOfActivations];
+
+/// Task storing the time stamp of each activation
+class StampTask : public Tasking::TaskProvider<1u, Tasking::SchedulePolicyFifo>
+{
+public:
+    explicit StampTask(Tasking::Scheduler& scheduler) : TaskProvider(scheduler, "Stmp"), count(0u)
+    {
+        inputs[0].configure(1u);
+    }
+
+    void
+    execute(void) override
+    {
+        if (count < numberOfActivations)
+        {
+            activations[count] = std::chrono::steady_clock::now();
+            ++count;
+        }
+    }
+
+    /// Number of stored time stamps
+    volatile unsigned int count;
+};
+
+int
+main(void)
+{
+    if (period == 0u)
+    {
+        std::printf("Time resolution of %llu ticks per second is too coarse for 10 kHz, build with "
+                    "timeResolution=us or timeResolution=ns.\n",
+                    static_cast<unsigned long long>(Tasking::ticksPerSecond));
+        return 1;
+    }
+
+    Tasking::SchedulerProvider<1u, Tasking::SchedulePolicyFifo> scheduler;
+    Tasking::Event trigger(scheduler);
+    StampTask task(scheduler);
+    task.configureInput(0u, trigger);
+    trigger.setPeriodicTiming(period, Tasking::fromMilliseconds(10u));
+    scheduler.start();
+
+    while (task.count < numberOfActivations)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    trigger.stop();
+    scheduler.terminate();
+
+    // Jitter is the deviation of the interval between two activations from the period. The drift is the deviation
+    // from the ideal activation grid given by the first activation.
+    const double periodNs = static_cast<double>(Tasking::toNanoseconds(period));
+    double sum = 0.0;
+    double maximumDrift = 0.0;
+    for (unsigned int i = 1u; i < numberOfActivations; ++i)
+    {
+        double interval = std::chrono::duration<double, std::nano>(activations[i] - activations[i - 1u]).count();
+        sum += interval;
+        jitter[i - 1u] = std::fabs(interval - periodNs);
+        double drift = std::chrono::duration<double, std::nano>(activations[i] - activations[0]).count() - i * periodNs;
+        maximumDrift = std::max(maximumDrift, std::fabs(drift));
+    }
+    const unsigned int samples = numberOfActivations - 1u;
+    std::sort(jitter, jitter + samples);
+
+    std::printf("period %.0f ns, %u activations, mean interval %.0f ns\n", periodNs, numberOfActivations,
+                sum / samples);
+    std::printf("jitter median %.0f ns, 99%% %.0f ns, 99.9%% %.0f ns, maximum %.0f ns\n", jitter[samples / 2u],
+                jitter[(samples * 99u) / 100u], jitter[(samples * 999u) / 1000u], jitter[samples - 1u]);
+    std::printf("maximum drift from activation grid %.0f ns\n", maximumDrift);
+    return 0;
+}
@@ -0,0 +1,152 @@
+/*
+ * mpmcQueueBenchmark.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Compare the lock-free MpmcQueue with the Fifo channel for work distribution from several producer threads to several
+ * consumer threads. The same number of producers and consumers is started, 1, 2, 4 and 8 of each. The producers push
+ * a fixed number of elements in total as fast as possible and the consumers pop until all elements are taken. A
+ * thread which can not push or pop yields the processor.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+#include <fifo.h>
+#include <mpmcQueue.h>
+
+/// Number of elements for each measurement
+static const unsigned int numberOfElements = 1000000u;
+
+/// Number of elements in the channels
+static const size_t channelSize = 1024u;
+
+/// Uniform access to the queue for the measurements
+struct QueueAccess
+{
+    typedef Tasking::MpmcQueue<uint64_t, channelSize> Channel;
+
+    static bool
+    push(Channel& channel, uint64_t value)
+    {
+        return channel.tryPush(value);
+    }
+
+    static bool
+    pop(Channel& channel, uint64_t& value)
+    {
+        return channel.tryPop(value);
+    }
+};
+
+/// Uniform access to the FIFO for the measurements
+struct FifoAccess
+{
+    typedef Tasking::Fifo<uint64_t, channelSize> Channel;
+
+    static bool
+    push(Channel& channel, uint64_t value)
+    {
+        return channel.push(value);
+    }
+
+    static bool
+    pop(Channel& channel, uint64_t& value)
+    {
+        uint64_t* element = channel.pop();
+        if (element != nullptr)
+        {
+            value = *element;
+            channel.release(element);
+        }
+        return element != nullptr;
+    }
+};
+
+/// Measure the throughput in million elements per second
+template<typename Access>
+static double
+throughput(unsigned int numberOfThreads)
+{
+    static typename Access::Channel channel;
+    std::atomic<unsigned int> popped(0u);
+    std::atomic<uint64_t> sum(0u);
+    std::vector<std::thread> threads;
+    unsigned int elementsPerProducer = numberOfElements / numberOfThreads;
+    unsigned int total = elementsPerProducer * numberOfThreads;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0u; i < numberOfThreads; ++i)
+    {
+        threads.emplace_back([elementsPerProducer]() {
+            for (unsigned int value = 0u; value < elementsPerProducer; ++value)
+            {
+                while (!Access::push(channel, value))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([total, &popped, &sum]() {
+            uint64_t localSum = 0u;
+            while (popped.load(std::memory_order_relaxed) < total)
+            {
+                uint64_t value;
+                if (Access::pop(channel, value))
+                {
+                    localSum += value;
+                    popped.fetch_add(1u, std::memory_order_relaxed);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+            sum += localSum;
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    std::chrono::duration<double, std::micro> span = std::chrono::steady_clock::now() - start;
+    if (sum != (static_cast<uint64_t>(numberOfThreads) * elementsPerProducer * (elementsPerProducer - 1u) / 2u))
+    {
+        std::printf("wrong sum\n");
+    }
+    return total / span.count();
+}
+
+int
+main(void)
+{
+    static const unsigned int threadCounts[] = {1u, 2u, 4u, 8u};
+    std::printf("%-20s %18s %18s\n", "producers/consumers", "Fifo", "MpmcQueue");
+    std::printf("%-20s %18s %18s\n", "", "million elements/s", "million elements/s");
+    for (unsigned int numberOfThreads : threadCounts)
+    {
+        double fifo = throughput<FifoAccess>(numberOfThreads);
+        double queue = throughput<QueueAccess>(numberOfThreads);
+        std::printf("%-20u %18.1f %18.1f\n", numberOfThreads, fifo, queue);
+        std::fflush(stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+ * slackBenchmark.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measure the wake ups of the clock for many periodic events with different offsets. The events run once without
+ * slack and once with a slack of a tenth of the period. The number of wake ups, fired events, and context switches
+ * of the process are reported for both runs.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <sys/resource.h>
+#include <thread>
+#include <vector>
+
+#include <schedulePolicyFifo.h>
+#include <schedulerProvider.h>
+#include <task.h>
+#include <taskEvent.h>
+
+/// Number of periodic events
+static const unsigned int numberOfEvents = 100u;
+
+/// Period of all events, the offsets are spread over the period
+static const Tasking::Time period = Tasking::fromMilliseconds(100u);
+
+/// Duration of one run
+static const std::chrono::seconds runTime(2);
+
+/// @return Number of context switches of the process
+static long
+contextSwitches(void)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_nvcsw + usage.ru_nivcsw;
+}
+
+/// Run all events with the given slack and print out the counters
+static void
+run(Tasking::Scheduler& scheduler, std::vector<std::unique_ptr<Tasking::Event> >& events, Tasking::Time slack)
+{
+    const Tasking::Time start = scheduler.getTime() + Tasking::fromMilliseconds(10u);
+    for (unsigned int i = 0u; i < numberOfEvents; ++i)
+    {
+        events[i]->stop();
+        events[i]->setSlack(slack);
+        events[i]->setPeriodicTiming(period, start + (i * period) / numberOfEvents);
+    }
+    Tasking::Clock::Statistic statistic;
+    scheduler.readClockStatistic(statistic);
+    long switches = contextSwitches();
+
+    std::this_thread::sleep_for(runTime);
+
+    switches = contextSwitches() - switches;
+    scheduler.readClockStatistic(statistic);
+    std::printf("slack %6llu ticks: %6u wake ups, %6u fired events, %5.1f events per wake up, %6ld context switches\n",
+                static_cast<unsigned long long>(slack), statistic.wakeUps, statistic.firedEvents,
+                (statistic.wakeUps != 0u) ? static_cast<double>(statistic.firedEvents) / statistic.wakeUps : 0.0,
+                switches);
+}
+
+int
+main(void)
+{
+    Tasking::SchedulerProvider<1u, Tasking::SchedulePolicyFifo> scheduler;
+    std::vector<std::unique_ptr<Tasking::Event> > events;
+    for (unsigned int i = 0u; i < numberOfEvents; ++i)
+    {
+        events.emplace_back(new Tasking::Event(scheduler));
+    }
+    scheduler.start();
+
+    std::printf("%u periodic events with period %llu ticks, offsets spread over the period\n", numberOfEvents,
+                static_cast<unsigned long long>(period));
+    run(scheduler, events, 0u);
+    run(scheduler, events, period / 10u);
+
+    for (unsigned int i = 0u; i < numberOfEvents; ++i)
+    {
+        events[i]->stop();
+    }
+    scheduler.terminate();
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * spscRingBenchmark.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Compare the lock-free SpscRing with the Fifo channel for one producer and one consumer thread. The throughput is
+ * measured by a producer which pushes a number of elements as fast as possible to a consumer. The latency is measured
+ * by a ping pong of one element over two channels, the half round trip time is reported. A side which can not push
+ * or pop yields the processor.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <stdint.h>
+#include <thread>
+
+#include <fifo.h>
+#include <spscRing.h>
+
+/// Number of elements for the throughput measurement
+static const unsigned int numberOfElements = 1000000u;
+
+/// Number of round trips for the latency measurement
+static const unsigned int numberOfRoundTrips = 100000u;
+
+/// Number of elements in the channels
+static const size_t channelSize = 1024u;
+
+/// Uniform access to the ring for the measurements
+struct RingAccess
+{
+    typedef Tasking::SpscRing<uint64_t, channelSize> Channel;
+
+    static bool
+    push(Channel& channel, uint64_t value)
+    {
+        return channel.push(value);
+    }
+
+    static bool
+    pop(Channel& channel, uint64_t& value)
+    {
+        return channel.pop(value);
+    }
+};
+
+/// Uniform access to the FIFO for the measurements
+struct FifoAccess
+{
+    typedef Tasking::Fifo<uint64_t, channelSize> Channel;
+
+    static bool
+    push(Channel& channel, uint64_t value)
+    {
+        return channel.push(value);
+    }
+
+    static bool
+    pop(Channel& channel, uint64_t& value)
+    {
+        uint64_t* element = channel.pop();
+        if (element != nullptr)
+        {
+            value = *element;
+            channel.release(element);
+        }
+        return element != nullptr;
+    }
+};
+
+/// Push a value and yield until it is pushed
+template<typename Access>
+static void
+send(typename Access::Channel& channel, uint64_t value)
+{
+    while (!Access::push(channel, value))
+    {
+        std::this_thread::yield();
+    }
+}
+
+/// Pop a value and yield until one is popped
+template<typename Access>
+static uint64_t
+receive(typename Access::Channel& channel)
+{
+    uint64_t value;
+    while (!Access::pop(channel, value))
+    {
+        std::this_thread::yield();
+    }
+    return value;
+}
+
+/// Measure the throughput in million elements per second
+template<typename Access>
+static double
+throughput(void)
+{
+    static typename Access::Channel channel;
+    uint64_t sum = 0u;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::thread producer([]() {
+        for (unsigned int i = 0u; i < numberOfElements; ++i)
+        {
+            send<Access>(channel, i);
+        }
+    });
+    for (unsigned int i = 0u; i < numberOfElements; ++i)
+    {
+        sum += receive<Access>(channel);
+    }
+    producer.join();
+    std::chrono::duration<double, std::micro> span = std::chrono::steady_clock::now() - start;
+    if (sum != (static_cast<uint64_t>(numberOfElements) * (numberOfElements - 1u) / 2u))
+    {
+        std::printf("wrong sum\n");
+    }
+    return numberOfElements / span.count();
+}
+
+/// Measure the latency of a ping pong in nanoseconds
+template<typename Access>
+static double
+latency(void)
+{
+    static typename Access::Channel ping;
+    static typename Access::Channel pong;
+    std::thread echo([]() {
+        for (unsigned int i = 0u; i < numberOfRoundTrips; ++i)
+        {
+            send<Access>(pong, receive<Access>(ping));
+        }
+    });
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0u; i < numberOfRoundTrips; ++i)
+    {
+        send<Access>(ping, i);
+        receive<Access>(pong);
+    }
+    std::chrono::duration<double, std::nano> span = std::chrono::steady_clock::now() - start;
+    echo.join();
+    return span.count() / (2u * numberOfRoundTrips);
+}
+
+int
+main(void)
+{
+    std::printf("%-8s %18s %16s\n", "channel", "million elements/s", "latency in ns");
+    std::printf("%-8s %18.1f %16.1f\n", "Fifo", throughput<FifoAccess>(), latency<FifoAccess>());
+    std::fflush(stdout);
+    std::printf("%-8s %18.1f %16.1f\n", "SpscRing", throughput<RingAccess>(), latency<RingAccess>());
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * timeOutBenchmark.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measure watchdog style time outs which are restarted by each message before they expire. Each time out is restarted
+ * once per tick, either with Event::trigger, which moves the queue entry, or with Event::restart, which postpones the
+ * entry. The time is reported per restart.
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include <schedulePolicyFifo.h>
+#include <schedulerUnitTest.h>
+#include <taskEvent.h>
+
+/// Time out of each watchdog in ticks
+static const Tasking::Time timeOut = 100u;
+
+/// Number of ticks with messages
+static const unsigned int numberOfTicks = 1000u;
+
+/// Restart a number of time outs at each tick with trigger or restart.
+static void
+benchmark(unsigned int numberOfEvents, bool lazy)
+{
+    Tasking::SchedulePolicyFifo policy;
+    Tasking::SchedulerUnitTest scheduler(policy);
+    Tasking::Event** events = new Tasking::Event*[numberOfEvents];
+    for (unsigned int i = 0; i < numberOfEvents; ++i)
+    {
+        events[i] = new Tasking::Event(scheduler);
+        events[i]->trigger(timeOut);
+    }
+    scheduler.start();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int tick = 0u; tick < numberOfTicks; ++tick)
+    {
+        for (unsigned int i = 0; i < numberOfEvents; ++i)
+        {
+            if (lazy)
+            {
+                events[i]->restart(timeOut);
+            }
+            else
+            {
+                events[i]->trigger(timeOut);
+            }
+        }
+        scheduler.schedule(1u);
+    }
+    std::chrono::duration<double, std::nano> span = std::chrono::steady_clock::now() - start;
+
+    std::printf("%-8s %7u %12.1f\n", lazy ? "restart" : "trigger", numberOfEvents,
+                span.count() / (numberOfTicks * numberOfEvents));
+    std::fflush(stdout);
+
+    for (unsigned int i = 0; i < numberOfEvents; ++i)
+    {
+        delete events[i];
+    }
+    delete[] events;
+}
+
+int
+main(void)
+{
+    const unsigned int sizes[] = {10u, 100u, 1000u};
+    std::printf("%-8s %7s %12s\n", "method", "timers", "ns per call");
+    for (unsigned int size : sizes)
+    {
+        benchmark(size, false);
+        benchmark(size, true);
+    }
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * timeSourceBenchmark.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measure the cost of one request of the time by the system clocks, the time source with the calibrated TSC, and the
+ * getTime method of a scheduler. The scheduler uses the clock selected by the build option linuxClock, with
+ * linuxClock = tsc the time is taken from the time source.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <time.h>
+
+#include <schedulePolicyFifo.h>
+#include <schedulerProvider.h>
+#include <timeSource.h>
+
+/// Number of time requests for each measurement
+static const unsigned int numberOfCalls = 10000000u;
+
+/// Sum of all requested times, printed to keep the requests
+static uint64_t checkSum = 0u;
+
+/// Measure the requests of a time and print the time per call.
+template<typename Function>
+static void
+benchmark(const char* name, Function request)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0u; i < numberOfCalls; ++i)
+    {
+        checkSum += request();
+    }
+    std::chrono::duration<double, std::nano> span = std::chrono::steady_clock::now() - start;
+
+    std::printf("%-26s %12.1f\n", name, span.count() / numberOfCalls);
+    std::fflush(stdout);
+}
+
+int
+main(void)
+{
+    Tasking::TimeSource timeSource;
+    Tasking::SchedulerProvider<1u, Tasking::SchedulePolicyFifo> scheduler;
+
+    std::printf("TSC is %s\n", timeSource.isTscUsed() ? "used" : "not invariant, CLOCK_MONOTONIC is used");
+    std::printf("%-26s %12s\n", "time source", "ns per call");
+    benchmark("clock_gettime realtime", []() {
+        struct timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+        return static_cast<uint64_t>(now.tv_nsec);
+    });
+    benchmark("clock_gettime monotonic", []() {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<uint64_t>(now.tv_nsec);
+    });
+    benchmark("TimeSource", [&timeSource]() { return timeSource.getNanoseconds(); });
+    benchmark("Scheduler::getTime", [&scheduler]() { return scheduler.getTime(); });
+    std::printf("check sum %llu\n", static_cast<unsigned long long>(checkSum));
+    return 0;
+}
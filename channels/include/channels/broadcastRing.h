@@ -0,0 +1,360 @@
+/*
+ * broadcastRing.h
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHANNELS_INCLUDE_CHANNELS_BROADCASTRING_H_
+#define CHANNELS_INCLUDE_CHANNELS_BROADCASTRING_H_
+
+#include <atomic>
+#include <stddef.h>
+#include <type_traits>
+
+#include <taskChannel.h>
+#include <taskUtils.h>
+
+#include "cacheLine.h"
+
+namespace Tasking
+{
+
+template<typename T, size_t size>
+class BroadcastReader;
+
+/**
+ * Ring buffer channel for one producer and any number of readers. Each element pushed to the ring is read by every
+ * reader. A reader only owns a sequence cursor of the next element to read, so no bookkeeping per element and no
+ * bit mask of readers is needed. The producer reuses a slot when all readers have passed it, i.e. the distance
+ * between its tail and the minimum of all reader cursors is below the size of the ring. The minimum is computed only
+ * when the ring seems to be full.
+ *
+ * Each successful push notifies the associated inputs like a push of the channel. Connect the inputs of all reading
+ * tasks to the ring and give each task an own BroadcastReader.
+ *
+ * Only one task shall push at the same time. A slow reader blocks the producer when the ring is full, it is not
+ * overrun.
+ *
+ * @tparam T Data type of the elements. The type shall support an assignment operator.
+ * @tparam size Number of elements in the ring. It must be a power of two.
+ *
+ * @see BroadcastReader
+ */
+template<typename T, size_t size>
+class BroadcastRing : public Channel
+{
+    friend class BroadcastReader<T, size>;
+
+public:
+    /**
+     * Initialize an empty ring without readers.
+     * @param channelId Identification of the channel.
+     */
+    explicit BroadcastRing(ChannelId channelId = 0);
+
+    /**
+     * Initialize an empty ring without readers.
+     * @param channelName Name of the channel.
+     */
+    explicit BroadcastRing(const char* channelName);
+
+    // Disabling copy constructor
+    BroadcastRing(const BroadcastRing&) = delete;
+    // Disabling assignment operator
+    BroadcastRing& operator=(const BroadcastRing&) = delete;
+
+    /**
+     * Copy data into the ring and notify associated inputs. Only called by the producer.
+     *
+     * @param data Data to copy into the ring.
+     * @result True if the data is pushed, false if at least one reader has not read the oldest element in the ring.
+     */
+    bool push(const T& data);
+
+    /// @result Number of associated readers.
+    unsigned int getNumberOfReaders(void) const;
+
+protected:
+    using Tasking::Channel::push;
+
+    /**
+     * Compute the minimum cursor of all readers. Without readers the minimum is the tail, so all slots are free.
+     *
+     * @param currentTail Tail of the producer.
+     * @result Sequence number of the oldest element which is not read by all readers.
+     */
+    size_t getMinimumCursor(size_t currentTail);
+
+    /**
+     * Add a reader to the ring. The reader starts with the next pushed element.
+     * @param reader Reader to add.
+     */
+    void attach(BroadcastReader<T, size>& reader);
+
+    /**
+     * Remove a reader from the ring.
+     * @param reader Reader to remove.
+     */
+    void detach(BroadcastReader<T, size>& reader);
+
+    /// Mask to compute the position of a sequence number in the ring
+    static const size_t mask = size - 1u;
+
+    /// Sequence number of the next element to write, only written by the producer.
+    std::atomic<size_t> tail;
+
+    /// Last computed minimum of the reader cursors by the producer
+    size_t cachedMinimum;
+
+    /// Padding to place the elements in another cache line than the tail
+    char tailPadding[cacheLineSize - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+    /// Storage of the elements
+    T m_data[size];
+
+    /// Head of the list of associated readers
+    BroadcastReader<T, size>* readers;
+
+    /// Mutex to synchronize the list of readers. It is only entered to change the list or to compute the minimum.
+    mutable Mutex readerMutex;
+};
+
+/**
+ * Reader of a broadcast ring. Each reader sees all elements pushed to the ring after the construction of the reader.
+ * Only one task shall pop from a reader at the same time.
+ *
+ * @tparam T Data type of the elements.
+ * @tparam size Number of elements in the ring.
+ */
+template<typename T, size_t size>
+class BroadcastReader
+{
+    friend class BroadcastRing<T, size>;
+
+public:
+    /**
+     * Associate the reader to a ring. The reader starts with the next pushed element.
+     * @param ring Ring to read from.
+     */
+    explicit BroadcastReader(BroadcastRing<T, size>& ring);
+
+    /// Remove the reader from the ring, so it does not hold back the producer anymore.
+    ~BroadcastReader(void);
+
+    // Disabling copy constructor
+    BroadcastReader(const BroadcastReader&) = delete;
+    // Disabling assignment operator
+    BroadcastReader& operator=(const BroadcastReader&) = delete;
+
+    /**
+     * Copy the oldest element not read by this reader.
+     *
+     * @param data [out] Reference to copy the element to.
+     * @result True if an element is read, false if the reader has read all elements.
+     */
+    bool pop(T& data);
+
+    /// @result True if the reader has read all elements.
+    bool isEmpty(void) const;
+
+    /// @result Number of elements not read by this reader.
+    size_t getCount(void) const;
+
+protected:
+    /// Sequence number of the next element to read, only written by the reader.
+    std::atomic<size_t> cursor;
+
+    /// Padding to place the cursors of readers in different cache lines
+    char cursorPadding[cacheLineSize - sizeof(std::atomic<size_t>)];
+
+    /// Ring the reader is associated to
+    BroadcastRing<T, size>& ring;
+
+    /// Next reader in the list of readers of the ring
+    BroadcastReader* nextReader;
+};
+
+// ----- Implementation part -----
+
+template<typename T, size_t size>
+BroadcastRing<T, size>::BroadcastRing(const ChannelId channelId) :
+    Channel(channelId), tail(0u), cachedMinimum(0u), readers(nullptr)
+{
+    static_assert((size > 0u) && ((size & (size - 1u)) == 0u), "Size of the ring must be a power of two");
+    static_assert(std::is_copy_assignable<T>::value, "Type needs an assignment operator");
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+BroadcastRing<T, size>::BroadcastRing(const char* channelName) :
+    Channel(channelName), tail(0u), cachedMinimum(0u), readers(nullptr)
+{
+    static_assert((size > 0u) && ((size & (size - 1u)) == 0u), "Size of the ring must be a power of two");
+    static_assert(std::is_copy_assignable<T>::value, "Type needs an assignment operator");
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+bool
+BroadcastRing<T, size>::push(const T& data)
+{
+    bool result = false;
+    const size_t currentTail = tail.load(std::memory_order_relaxed);
+    // Compute the minimum of the reader cursors only when the ring seems to be full
+    if ((currentTail - cachedMinimum) == size)
+    {
+        cachedMinimum = getMinimumCursor(currentTail);
+    }
+    if ((currentTail - cachedMinimum) != size)
+    {
+        m_data[currentTail & mask] = data;
+        // Publish the element before the inputs are notified
+        tail.store(currentTail + 1u, std::memory_order_release);
+        Channel::pushData(&data, sizeof(T));
+        result = true;
+    }
+    return result;
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+unsigned int
+BroadcastRing<T, size>::getNumberOfReaders(void) const
+{
+    unsigned int result = 0u;
+    readerMutex.enter();
+    for (BroadcastReader<T, size>* reader = readers; reader != nullptr; reader = reader->nextReader)
+    {
+        result++;
+    }
+    readerMutex.leave();
+    return result;
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+size_t
+BroadcastRing<T, size>::getMinimumCursor(const size_t currentTail)
+{
+    // The reader with the largest distance to the tail has the minimum cursor, which is also correct when the
+    // sequence numbers wrap around.
+    size_t maximumDistance = 0u;
+    readerMutex.enter();
+    for (BroadcastReader<T, size>* reader = readers; reader != nullptr; reader = reader->nextReader)
+    {
+        size_t distance = currentTail - reader->cursor.load(std::memory_order_acquire);
+        if (distance > maximumDistance)
+        {
+            maximumDistance = distance;
+        }
+    }
+    readerMutex.leave();
+    return currentTail - maximumDistance;
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+void
+BroadcastRing<T, size>::attach(BroadcastReader<T, size>& reader)
+{
+    readerMutex.enter();
+    reader.cursor.store(tail.load(std::memory_order_acquire), std::memory_order_relaxed);
+    reader.nextReader = readers;
+    readers = &reader;
+    readerMutex.leave();
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+void
+BroadcastRing<T, size>::detach(BroadcastReader<T, size>& reader)
+{
+    readerMutex.enter();
+    BroadcastReader<T, size>** link = &readers;
+    while ((*link != nullptr) && (*link != &reader))
+    {
+        link = &((*link)->nextReader);
+    }
+    if (*link != nullptr)
+    {
+        *link = reader.nextReader;
+    }
+    reader.nextReader = nullptr;
+    readerMutex.leave();
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+BroadcastReader<T, size>::BroadcastReader(BroadcastRing<T, size>& p_ring) :
+    cursor(0u), ring(p_ring), nextReader(nullptr)
+{
+    ring.attach(*this);
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+BroadcastReader<T, size>::~BroadcastReader(void)
+{
+    ring.detach(*this);
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+bool
+BroadcastReader<T, size>::pop(T& data)
+{
+    bool result = false;
+    const size_t currentCursor = cursor.load(std::memory_order_relaxed);
+    if (currentCursor != ring.tail.load(std::memory_order_acquire))
+    {
+        data = ring.m_data[currentCursor & BroadcastRing<T, size>::mask];
+        // Free the element for the producer when all other readers have read it too
+        cursor.store(currentCursor + 1u, std::memory_order_release);
+        result = true;
+    }
+    return result;
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+bool
+BroadcastReader<T, size>::isEmpty(void) const
+{
+    return cursor.load(std::memory_order_acquire) == ring.tail.load(std::memory_order_acquire);
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+size_t
+BroadcastReader<T, size>::getCount(void) const
+{
+    const size_t currentCursor = cursor.load(std::memory_order_acquire);
+    return ring.tail.load(std::memory_order_acquire) - currentCursor;
+}
+
+} // namespace Tasking
+
+#endif /* CHANNELS_INCLUDE_CHANNELS_BROADCASTRING_H_ */
@@ -0,0 +1,35 @@
+/*
+ * cacheLine.h
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHANNELS_INCLUDE_CHANNELS_CACHELINE_H_
+#define CHANNELS_INCLUDE_CHANNELS_CACHELINE_H_
+
+#include <stddef.h>
+
+namespace Tasking
+{
+
+/**
+ * Size of a cache line. Indices of lock-free channels which are written by different threads are separated by at
+ * least this size, so a write of one thread does not invalidate the cache line of the other thread.
+ */
+static const size_t cacheLineSize = 64u;
+
+} // namespace Tasking
+
+#endif /* CHANNELS_INCLUDE_CHANNELS_CACHELINE_H_ */
@@ -187,10 +187,11 @@ DoubleBuffer<T>::send(const T inData)
 {
     // Call convert it to data so reference call can be used.
     data[backIndex] = inData;
+    const T* sent = data + backIndex;
     // Switch over buffers.
     backIndex = (backIndex + 1u) % bufferSize;
 
-    push();
+    pushData(sent, sizeof(T));
 }
 
 // ------------------------------------
@@ -204,10 +205,11 @@ DoubleBuffer<T>::send(const T* inData)
     {
         data[backIndex] = *inData;
     }
+    const T* sent = data + backIndex;
     // Switch over buffers.
     backIndex = (backIndex + 1u) % bufferSize;
 
-    push();
+    pushData(sent, sizeof(T));
 }
 
 // ------------------------------------
@@ -30,10 +30,22 @@
 namespace Tasking
 {
 
+/// Number of links of a FIFO reader when no number is given. It is the former fixed number of links of each reader.
+static const size_t defaultFifoReaderLinks = 2000u;
+
 /**
  * Class to read from a FIFO with several readers. Each reader assigned to the FIFO see the FIFO characteristic.
+ *
+ * A reader with links derived from the size of its FIFO is declared by Fifo<T, size>::Reader. The default number of
+ * links keeps readers declared without a number compatible, but each link takes two pointers, so the default costs
+ * about 32 KB per reader. Less links than the size of the FIFO save memory, but the reader can only hold that number
+ * of popped elements and pop delivers a null pointer until an element is released.
+ *
+ * @tparam T Data type of the FIFO elements.
+ * @tparam links Maximum number of elements popped by the reader and not released. It is sufficient to use the size
+ * of the FIFO, because the reader can not hold more elements.
  */
-template<typename T>
+template<typename T, size_t links = defaultFifoReaderLinks>
 class FifoReader : public FifoGenericReader
 {
 public:
@@ -57,6 +69,10 @@ public:
      * @see release
      */
     T* pop(void);
+
+private:
+    /// Pool of chain links for the management of popped elements.
+    Chain m_links[links];
 };
 
 /**
@@ -74,6 +90,9 @@ template<typename T, size_t size>
 class Fifo : public Channel
 {
 public:
+    /// Reader with one link per element of the FIFO, which is the maximum number of elements a reader can hold.
+    typedef FifoReader<T, size> Reader;
+
     /**
      * Initialize the FIFO stack as empty FIFO.
      *
@@ -132,6 +151,17 @@ public:
      */
     bool push(const T& data);
 
+    /**
+     * Push copies of several data elements into the FIFO stack. The associated inputs are notified once for the whole
+     * batch, so the cost of the activation is paid once per batch and not once per element.
+     *
+     * @param data Pointer to the first of the data elements to copy.
+     * @param count Number of data elements.
+     *
+     * @result Number of pushed elements. It is less than count when the FIFO stack has not enough free memory.
+     */
+    unsigned int pushBatch(const T* data, unsigned int count);
+
     /**
      * Request the oldest data in the FIFO stack and consume it. The data item is allocated by the caller and it shall
      * call release to provide the memory of the element for further use. If release is not called, the software has a
@@ -157,14 +187,16 @@ public:
      *
      * @param reader Pointer to the reader which should associated with the FIFO.
      */
-    void associateReader(FifoReader<T>& reader);
+    template<size_t links>
+    void associateReader(FifoReader<T, links>& reader);
 
     /**
      * Release an associated reader from the FIFO.
      *
      * @param reader Pointer to the FIFO reader to release.
      */
-    void releaseReader(FifoReader<T>& reader);
+    template<size_t links>
+    void releaseReader(FifoReader<T, links>& reader);
 
 protected:
     using Tasking::Channel::push;
@@ -186,6 +218,14 @@ protected:
     const T* getlastPushed(void) const;
 
 private:
+    /**
+     * Reset a data item to a default constructed one, when it is released by all readers. Data items like a
+     * MessageRef release their resources this way, even when several readers share the data item.
+     *
+     * @param data Pointer to the data item to reset.
+     */
+    static void resetElement(void* data);
+
     /// Memory area to hold data of the specified size
     T m_data[size];
 
@@ -200,12 +240,18 @@ private:
 
 // cppcheck-suppress uninitMemberVar -- m_management is initialized by genericFifo()
 template<typename T, size_t size>
-Fifo<T, size>::Fifo(ChannelId channelId) : Channel(channelId), genericFifo(m_management, m_data, sizeof(T), size)
+Fifo<T, size>::Fifo(ChannelId channelId) :
+    Channel(channelId),
+    genericFifo(m_management, m_data, sizeof(T), size,
+                std::is_trivially_destructible<T>::value ? nullptr : &Fifo<T, size>::resetElement)
 {
 }
 
 template<typename T, size_t size>
-Fifo<T, size>::Fifo(const char* channelName) : Channel(channelName), genericFifo(m_management, m_data, sizeof(T), size)
+Fifo<T, size>::Fifo(const char* channelName) :
+    Channel(channelName),
+    genericFifo(m_management, m_data, sizeof(T), size,
+                std::is_trivially_destructible<T>::value ? nullptr : &Fifo<T, size>::resetElement)
 {
 }
 
@@ -237,7 +283,7 @@ Fifo<T, size>::push(const T* data)
     m_fifo_mutex.enter();
     if (genericFifo.push(data))
     {
-        Channel::push();
+        Channel::pushData(data, sizeof(T));
         result = true;
     }
     m_fifo_mutex.leave();
@@ -261,6 +307,29 @@ Fifo<T, size>::push(const T& data)
     return result;
 }
 
+template<typename T, size_t size>
+unsigned int
+Fifo<T, size>::pushBatch(const T* data, unsigned int count)
+{
+    static_assert(std::is_copy_assignable<T>::value, "Type need a copy operator");
+
+    unsigned int pushed = 0u;
+    // The whole batch is in the FIFO before the inputs are notified, so readers synchronize on all elements
+    m_fifo_mutex.enter();
+    T* target = (count > 0u) ? static_cast<T*>(genericFifo.allocate()) : nullptr;
+    while (target != nullptr)
+    {
+        *target = data[pushed];
+        genericFifo.push(target);
+        Channel::tap(target, sizeof(T));
+        pushed++;
+        target = (pushed < count) ? static_cast<T*>(genericFifo.allocate()) : nullptr;
+    }
+    Channel::pushBatch(pushed);
+    m_fifo_mutex.leave();
+    return pushed;
+}
+
 template<typename T, size_t size>
 T*
 Fifo<T, size>::pop(void)
@@ -269,15 +338,17 @@ Fifo<T, size>::pop(void)
 }
 
 template<typename T, size_t size>
+template<size_t links>
 void
-Fifo<T, size>::associateReader(FifoReader<T>& reader)
+Fifo<T, size>::associateReader(FifoReader<T, links>& reader)
 {
     genericFifo.associateReader(reader);
 }
 
 template<typename T, size_t size>
+template<size_t links>
 void
-Fifo<T, size>::releaseReader(FifoReader<T>& reader)
+Fifo<T, size>::releaseReader(FifoReader<T, links>& reader)
 {
     genericFifo.releaseReader(reader);
 }
@@ -305,21 +376,29 @@ Fifo<T, size>::getlastPushed(void) const
     return static_cast<const T*>(genericFifo.getlastPushed());
 }
 
-template<typename T>
-FifoReader<T>::FifoReader(Tasking::Task* task) : FifoGenericReader(task)
+template<typename T, size_t size>
+void
+Fifo<T, size>::resetElement(void* data)
+{
+    *static_cast<T*>(data) = T();
+}
+
+template<typename T, size_t links>
+FifoReader<T, links>::FifoReader(Tasking::Task* task) : FifoGenericReader(task, m_links, links)
 {
+    static_assert(links > 0u, "A FIFO reader needs at least one link");
 }
 
-template<typename T>
+template<typename T, size_t links>
 void
-FifoReader<T>::release(T* data)
+FifoReader<T, links>::release(T* data)
 {
     FifoGenericReader::release(data);
 }
 
-template<typename T>
+template<typename T, size_t links>
 T*
-FifoReader<T>::pop(void)
+FifoReader<T, links>::pop(void)
 {
     return static_cast<T*>(FifoGenericReader::pop());
 }
@@ -41,15 +41,23 @@ public:
     /// Structure to manage memory of the FIFO
     struct Chain
     {
-        /// Pointer to the previous memory element
+        /// Pointer to the next memory element in the list of the element
         Chain* next;
+        /// Pointer to the previous memory element in the allocated list or in the FIFO, to unlink the element in
+        /// constant time
+        Chain* previous;
         /// One data item
         void* data;
         /// Number of remaining read calls from FIFO reader. Release in a reader is only possible when the number is
         /// zero.
         unsigned int expectedReadsBitMask;
+        /// True when the data item is in the list of allocated data items
+        bool allocated;
     };
 
+    /// Function to reset a data item before it is used again, e.g. to release resources held by the data item.
+    typedef void (*ResetFunction)(void* data);
+
     /**
      * Initialize the generic FIFO stack.
      *
@@ -57,8 +65,11 @@ public:
      * @param dataBuffer Pointer to the area for the data items provided by the FIFO stack
      * @param size Size of one data item in the buffer area
      * @param items Number of data items in the buffer area
+     * @param reset Function called for a data item when it is released by all readers or nullptr if the data items
+     * need no reset.
      */
-    FifoGeneric(struct FifoGeneric::Chain* chain, void* dataBuffer, const size_t size, const unsigned int items);
+    FifoGeneric(struct FifoGeneric::Chain* chain, void* dataBuffer, const size_t size, const unsigned int items,
+                ResetFunction reset = nullptr);
 
     /**
      * Reserve a data item provided by the FIFO stack.
@@ -150,14 +161,47 @@ protected:
 
 private:
     /**
-     * Find in the allocated list the chaining element which is previous to the associated
-     * to the data element.
+     * Find the chaining element of an allocated data item. The element is computed by the position of the data
+     * item in the data buffer, so no list is searched.
+     *
+     * @param data Pointer to the data item.
+     *
+     * @result Pointer to the chain element associated with the data item or nullptr if the data item is not
+     * provided by the FIFO stack or not allocated.
+     */
+    Chain* findAllocated(const void* data) const;
+
+    /**
+     * Remove an element from the list of allocated data items.
+     *
+     * @param element Pointer to the chain element to remove. It shall be in the allocated list.
+     */
+    void unlinkAllocated(Chain* element);
+
+    /**
+     * Remove an element from the FIFO.
      *
-     * @param data Pointer to the data item which shall associated to the following chain element.
+     * @param element Pointer to the chain element to remove. It shall be in the FIFO.
+     */
+    void unlinkFifo(Chain* element);
+
+    /**
+     * Insert an element at the head of the list of allocated data items.
      *
-     * @result Pointer to the previous chain element to the one associated with the data item.
+     * @param element Pointer to the chain element to insert.
      */
-    Chain* findPrevious(const void* data) const;
+    void linkAllocated(Chain* element);
+
+    /// Pointer to the buffer area used for the management of the FIFO stack
+    Chain* const m_chain;
+    /// Pointer to the area of the data items
+    const char* const m_dataBuffer;
+    /// Size of one data item in the buffer area
+    const size_t m_itemSize;
+    /// Number of data items in the buffer area
+    const unsigned int m_items;
+    /// Function to reset a released data item or nullptr
+    const ResetFunction m_reset;
 
     /// Pointer to a chain of unused data items
     Chain* m_unused;
@@ -191,12 +235,23 @@ class FifoGenericReader
     friend class FifoGeneric;
 
 public:
+    /// Structure to manage by the reader popped elements from the FIFO
+    struct Chain
+    {
+        /// Pointer to the allocated element in the FIFO
+        FifoGeneric::Chain* fifoElement;
+        /// Pointer to the next link in the chain
+        Chain* next;
+    };
+
     /**
-     * A generic FIFO read is always associated with a task. The first constructor call will set up static elements.
+     * A generic FIFO read is always associated with a task.
      * @param task Pointer to the task the reader is connected to.
-     * @param fifo Associated fifo of the reader.
+     * @param links Pool of chain links to manage popped elements. Links are taken from the pool on demand, so the
+     * pool needs no initialization.
+     * @param numberOfLinks Number of links in the pool, which is the maximum number of popped elements not released.
      */
-    explicit FifoGenericReader(Tasking::Task* task);
+    FifoGenericReader(Tasking::Task* task, Chain* links, unsigned int numberOfLinks);
 
     /**
      * Cleanup static elements in the FIFO reader.
@@ -235,15 +290,6 @@ protected:
      */
     void* pop(void);
 
-    /// Structure to manage by the reader popped elements from the FIFO
-    struct Chain
-    {
-        /// Pointer to the allocated element in the FIFO
-        FifoGeneric::Chain* fifoElement;
-        /// Pointer to the next link in the chain
-        Chain* next;
-    };
-
     /// Pointer to the next reader or null pointer if last reader in List.
     FifoGenericReader* nextReader;
 
@@ -268,14 +314,17 @@ protected:
     /// Mutex to synchronize the access to unusedLinks
     Tasking::Mutex linkMutex;
 
-    /// Unused links in the pool of chain links
+    /// Released links of the pool of chain links
     struct Chain* unusedLinks;
 
-    static const int maximumFifoReaderLinks =
-            2000; // TODO this shouldn't be a constant and needs to be the same as fifo
+    /// Pool of chain links for the management of popped elements.
+    struct Chain* const linkPool;
+
+    /// Number of links in the pool
+    const unsigned int linkPoolSize;
 
-    /// Pool of chain links for the management of links.
-    struct Chain links[maximumFifoReaderLinks];
+    /// Number of links taken from the pool at least once. Links above this number were never used.
+    unsigned int usedLinks;
 };
 // FifoGenericReader
 
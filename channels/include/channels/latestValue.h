@@ -0,0 +1,197 @@
+/*
+ * latestValue.h
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHANNELS_INCLUDE_CHANNELS_LATESTVALUE_H_
+#define CHANNELS_INCLUDE_CHANNELS_LATESTVALUE_H_
+
+#include <atomic>
+#include <cstring>
+#include <stdint.h>
+#include <type_traits>
+
+#include <taskChannel.h>
+
+namespace Tasking
+{
+
+/**
+ * Channel with the latest value of one writing task for any number of reading tasks, protected by a sequence lock.
+ * The writer increments a sequence number before and after it writes the value, so the sequence number is odd during
+ * a write. A reader copies the value and repeats the copy when the sequence number was odd or has changed meanwhile.
+ * So readers always get a consistent copy and the writer never waits on a reader.
+ *
+ * Only one task shall send at the same time. The value is copied byte wise, the type shall be trivially copyable.
+ * For large types where readers would retry often, a TripleBuffer is the better choice.
+ *
+ * @tparam T Data type of the channel.
+ */
+template<typename T>
+class LatestValue : public Channel
+{
+public:
+    /**
+     * Initialize the channel with a value initialized element.
+     *
+     * @param channelId Identification of the channel.
+     */
+    LatestValue(const ChannelId channelId = 0);
+
+    /**
+     * Initialize the channel with a value initialized element.
+     *
+     * @param channelName Name of the channel.
+     */
+    LatestValue(const char* channelName);
+
+    /**
+     * Constructor with assignment of initial data.
+     *
+     * @param initialValue Initial value of the channel.
+     * @param channelId Identification of the channel.
+     */
+    LatestValue(const T& initialValue, const ChannelId channelId = 0);
+
+    /**
+     * Constructor with assignment of initial data and a channel name.
+     *
+     * @param initialValue Initial value of the channel.
+     * @param channelName Name of the channel.
+     */
+    LatestValue(const T& initialValue, const char* channelName);
+
+    /**
+     * Copy the latest value. Retries while the writer changes the value.
+     *
+     * @result Consistent copy of the latest sent value.
+     */
+    T read(void) const;
+
+    /**
+     * Try once to copy the latest value.
+     *
+     * @param data [out] Reference to copy the value to. It is only valid when the result is true.
+     * @result True if the copy is consistent, false if the writer changed the value during the copy.
+     */
+    bool tryRead(T& data) const;
+
+    /**
+     * Send data over the channel and notify the associated inputs.
+     *
+     * @param data Data to send.
+     */
+    void send(const T& data);
+
+    /// @result Number of send operations since construction.
+    uint32_t getNumberOfUpdates(void) const;
+
+protected:
+    /// Sequence number of the value, odd during a write.
+    std::atomic<uint32_t> sequence;
+
+    /// Latest value
+    T value;
+};
+
+// ----- Implementation part -----
+
+template<typename T>
+LatestValue<T>::LatestValue(const ChannelId channelId) : Channel(channelId), sequence(0u), value()
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Type needs to be trivially copyable");
+}
+
+// ------------------------------------
+
+template<typename T>
+LatestValue<T>::LatestValue(const char* channelName) : Channel(channelName), sequence(0u), value()
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Type needs to be trivially copyable");
+}
+
+// ------------------------------------
+
+template<typename T>
+LatestValue<T>::LatestValue(const T& initialValue, const ChannelId channelId) :
+    Channel(channelId), sequence(0u), value(initialValue)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Type needs to be trivially copyable");
+}
+
+// ------------------------------------
+
+template<typename T>
+LatestValue<T>::LatestValue(const T& initialValue, const char* channelName) :
+    Channel(channelName), sequence(0u), value(initialValue)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Type needs to be trivially copyable");
+}
+
+// ------------------------------------
+
+template<typename T>
+T
+LatestValue<T>::read(void) const
+{
+    T result;
+    while (!tryRead(result))
+    {
+    }
+    return result;
+}
+
+// ------------------------------------
+
+template<typename T>
+bool
+LatestValue<T>::tryRead(T& data) const
+{
+    const uint32_t before = sequence.load(std::memory_order_acquire);
+    std::memcpy(static_cast<void*>(&data), static_cast<const void*>(&value), sizeof(T));
+    // The copy shall be complete before the sequence number is checked again
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint32_t after = sequence.load(std::memory_order_relaxed);
+    return ((before & 1u) == 0u) && (before == after);
+}
+
+// ------------------------------------
+
+template<typename T>
+void
+LatestValue<T>::send(const T& data)
+{
+    const uint32_t current = sequence.load(std::memory_order_relaxed);
+    sequence.store(current + 1u, std::memory_order_relaxed);
+    // The odd sequence number shall be visible before the value is changed
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(static_cast<void*>(&value), static_cast<const void*>(&data), sizeof(T));
+    sequence.store(current + 2u, std::memory_order_release);
+    pushData(&data, sizeof(T));
+}
+
+// ------------------------------------
+
+template<typename T>
+uint32_t
+LatestValue<T>::getNumberOfUpdates(void) const
+{
+    return sequence.load(std::memory_order_acquire) / 2u;
+}
+
+} // namespace Tasking
+
+#endif /* CHANNELS_INCLUDE_CHANNELS_LATESTVALUE_H_ */
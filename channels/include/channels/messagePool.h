@@ -0,0 +1,373 @@
+/*
+ * messagePool.h
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHANNELS_INCLUDE_CHANNELS_MESSAGEPOOL_H_
+#define CHANNELS_INCLUDE_CHANNELS_MESSAGEPOOL_H_
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace Tasking
+{
+
+/**
+ * Generic lock-free pool of message buffers which operates on void pointers. Free buffers are kept in a stack, which
+ * is changed by a compare and swap of its head. The head carries a tag, which is incremented with each change, so a
+ * buffer taken and returned meanwhile does not corrupt the stack. Application developers should use the template
+ * class MessagePool instead of this implementation.
+ *
+ * @see MessagePool
+ */
+class MessagePoolGeneric
+{
+public:
+    /// Structure to manage one message buffer of the pool
+    struct Buffer
+    {
+        /// Number of references to the buffer. A free buffer has no reference.
+        std::atomic<unsigned int> references;
+        /// Index plus one of the next free buffer, zero for the last free buffer.
+        std::atomic<uint32_t> next;
+        /// Pool the buffer belongs to
+        MessagePoolGeneric* pool;
+        /// Data item of the buffer
+        void* data;
+    };
+
+    /**
+     * Initialize the pool with all buffers free.
+     *
+     * @param buffers Pointer to the area used for the management of the buffers
+     * @param dataBuffer Pointer to the area for the data items of the buffers
+     * @param size Size of one data item in the data area
+     * @param items Number of buffers
+     */
+    MessagePoolGeneric(Buffer* buffers, void* dataBuffer, size_t size, uint32_t items);
+
+    // Disabling copy constructor
+    MessagePoolGeneric(const MessagePoolGeneric&) = delete;
+    // Disabling assignment operator
+    MessagePoolGeneric& operator=(const MessagePoolGeneric&) = delete;
+
+    /**
+     * Take a free buffer from the pool. Can be called by several threads at the same time.
+     *
+     * @result Pointer to the buffer with one reference or nullptr if all buffers are in use.
+     */
+    Buffer* allocate(void);
+
+    /**
+     * Return a buffer without references to the pool. Can be called by several threads at the same time.
+     *
+     * @param buffer Pointer to the buffer to return.
+     */
+    void release(Buffer* buffer);
+
+    /// @result Number of free buffers at the time of the call.
+    uint32_t getNumberOfFreeBuffers(void) const;
+
+private:
+    /// Mask of the index part of the head
+    static const uint64_t indexMask = 0xFFFFFFFFu;
+
+    /// Increment of the tag in the upper half of the head
+    static const uint64_t tagIncrement = indexMask + 1u;
+
+    /// Management area of the buffers
+    Buffer* const m_buffers;
+
+    /// Index plus one of the first free buffer in the lower half and the tag in the upper half.
+    std::atomic<uint64_t> m_freeHead;
+
+    /// Number of free buffers
+    std::atomic<uint32_t> m_free;
+};
+
+/**
+ * Reference to a message buffer of a pool. References are copied instead of the message, so they can be pushed
+ * through channels like Fifo<MessageRef<T>, n>, SingleBuffer<MessageRef<T>> or DoubleBuffer<MessageRef<T>> and the
+ * message data is never copied. The buffer returns to its pool when the last reference is released or destroyed.
+ *
+ * A reference stored in a channel holds the buffer until it is overwritten, e.g. by the next send to a single buffer.
+ * A Fifo resets its element to an empty reference when the last reader releases the element. A reader of a Fifo
+ * shall not release the popped reference itself, because several FifoReaders share the same element.
+ *
+ * Several references to the same buffer can be copied and released by different threads at the same time. One
+ * reference object shall only be used by one thread at the same time.
+ *
+ * @tparam T Data type of the message.
+ */
+template<typename T>
+class MessageRef
+{
+    template<typename U, size_t size>
+    friend class MessagePool;
+
+public:
+    /// Initialize an empty reference
+    MessageRef(void);
+
+    /// Copy a reference and increment the number of references to the buffer.
+    MessageRef(const MessageRef& other);
+
+    /// Move a reference, the other reference becomes empty.
+    MessageRef(MessageRef&& other);
+
+    /// Release the reference
+    ~MessageRef(void);
+
+    /// Release the own reference and copy the other one.
+    MessageRef& operator=(const MessageRef& other);
+
+    /// Release the own reference and move the other one, the other reference becomes empty.
+    MessageRef& operator=(MessageRef&& other);
+
+    /// @result True if the reference points to a buffer.
+    bool isValid(void) const;
+
+    /// @result Pointer to the message or nullptr for an empty reference.
+    T* get(void) const;
+
+    /// @result Reference to the message. The reference shall not be empty.
+    T& operator*(void) const;
+
+    /// @result Pointer to the message. The reference shall not be empty.
+    T* operator->(void) const;
+
+    /// @result Number of references to the buffer or zero for an empty reference.
+    unsigned int getReferences(void) const;
+
+    /// Release the reference. When it was the last reference, the buffer returns to its pool.
+    void release(void);
+
+protected:
+    /**
+     * Take over the first reference of a newly allocated buffer.
+     *
+     * @param buffer Pointer to the buffer or nullptr for an empty reference.
+     */
+    explicit MessageRef(MessagePoolGeneric::Buffer* buffer);
+
+    /// Referenced buffer or nullptr
+    MessagePoolGeneric::Buffer* m_buffer;
+};
+
+/**
+ * Pool of message buffers with reference counting. A message is allocated once, filled and forwarded by references
+ * through the channels of a pipeline, so large messages like images are not copied from stage to stage.
+ *
+ * The messages are constructed with the pool and not destroyed when a buffer returns to the pool, so a newly
+ * allocated message contains the data of its former use.
+ *
+ * @tparam T Data type of the messages. The type needs a default constructor.
+ * @tparam size Number of message buffers in the pool.
+ */
+template<typename T, size_t size>
+class MessagePool
+{
+public:
+    /// Initialize the pool with all buffers free.
+    MessagePool(void);
+
+    /**
+     * Allocate a message buffer. Can be called by several threads at the same time.
+     *
+     * @result Reference to the message buffer or an empty reference if all buffers are in use.
+     */
+    MessageRef<T> allocate(void);
+
+    /// @result Number of free buffers at the time of the call.
+    uint32_t getNumberOfFreeBuffers(void) const;
+
+private:
+    /// Memory area for the messages
+    T m_data[size];
+
+    /// Memory area for the management of the buffers
+    MessagePoolGeneric::Buffer m_buffers[size];
+
+    /// Lock-free pool on the buffers
+    MessagePoolGeneric m_pool;
+};
+
+// ----- Implementation part -----
+
+template<typename T>
+MessageRef<T>::MessageRef(void) : m_buffer(nullptr)
+{
+}
+
+// ------------------------------------
+
+template<typename T>
+MessageRef<T>::MessageRef(MessagePoolGeneric::Buffer* buffer) : m_buffer(buffer)
+{
+}
+
+// ------------------------------------
+
+template<typename T>
+MessageRef<T>::MessageRef(const MessageRef& other) : m_buffer(other.m_buffer)
+{
+    if (m_buffer != nullptr)
+    {
+        m_buffer->references.fetch_add(1u, std::memory_order_relaxed);
+    }
+}
+
+// ------------------------------------
+
+template<typename T>
+MessageRef<T>::MessageRef(MessageRef&& other) : m_buffer(other.m_buffer)
+{
+    other.m_buffer = nullptr;
+}
+
+// ------------------------------------
+
+template<typename T>
+MessageRef<T>::~MessageRef(void)
+{
+    release();
+}
+
+// ------------------------------------
+
+template<typename T>
+MessageRef<T>&
+MessageRef<T>::operator=(const MessageRef& other)
+{
+    // Take the new reference before the old one is released, which also handles the assignment of itself.
+    if (other.m_buffer != nullptr)
+    {
+        other.m_buffer->references.fetch_add(1u, std::memory_order_relaxed);
+    }
+    release();
+    m_buffer = other.m_buffer;
+    return *this;
+}
+
+// ------------------------------------
+
+template<typename T>
+MessageRef<T>&
+MessageRef<T>::operator=(MessageRef&& other)
+{
+    if (this != &other)
+    {
+        release();
+        m_buffer = other.m_buffer;
+        other.m_buffer = nullptr;
+    }
+    return *this;
+}
+
+// ------------------------------------
+
+template<typename T>
+bool
+MessageRef<T>::isValid(void) const
+{
+    return m_buffer != nullptr;
+}
+
+// ------------------------------------
+
+template<typename T>
+T*
+MessageRef<T>::get(void) const
+{
+    return (m_buffer != nullptr) ? static_cast<T*>(m_buffer->data) : nullptr;
+}
+
+// ------------------------------------
+
+template<typename T>
+T&
+MessageRef<T>::operator*(void) const
+{
+    return *get();
+}
+
+// ------------------------------------
+
+template<typename T>
+T*
+MessageRef<T>::operator->(void) const
+{
+    return get();
+}
+
+// ------------------------------------
+
+template<typename T>
+unsigned int
+MessageRef<T>::getReferences(void) const
+{
+    return (m_buffer != nullptr) ? m_buffer->references.load(std::memory_order_acquire) : 0u;
+}
+
+// ------------------------------------
+
+template<typename T>
+void
+MessageRef<T>::release(void)
+{
+    if (m_buffer != nullptr)
+    {
+        // All accesses to the message by other references happen before the buffer is returned
+        if (m_buffer->references.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+        {
+            m_buffer->pool->release(m_buffer);
+        }
+        m_buffer = nullptr;
+    }
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+MessagePool<T, size>::MessagePool(void) : m_pool(m_buffers, m_data, sizeof(T), size)
+{
+    static_assert(std::is_default_constructible<T>::value, "Type needs to be default constructible");
+    static_assert((size > 0u) && (size < 0xFFFFFFFFu), "Number of buffers must fit into the index of the pool");
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+MessageRef<T>
+MessagePool<T, size>::allocate(void)
+{
+    return MessageRef<T>(m_pool.allocate());
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+uint32_t
+MessagePool<T, size>::getNumberOfFreeBuffers(void) const
+{
+    return m_pool.getNumberOfFreeBuffers();
+}
+
+} // namespace Tasking
+
+#endif /* CHANNELS_INCLUDE_CHANNELS_MESSAGEPOOL_H_ */
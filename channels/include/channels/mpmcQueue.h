@@ -0,0 +1,274 @@
+/*
+ * mpmcQueue.h
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHANNELS_INCLUDE_CHANNELS_MPMCQUEUE_H_
+#define CHANNELS_INCLUDE_CHANNELS_MPMCQUEUE_H_
+
+#include <atomic>
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+#include <taskChannel.h>
+
+#include "cacheLine.h"
+
+namespace Tasking
+{
+
+/**
+ * Bounded lock-free queue channel for several producers and several consumers. Each slot of the queue carries a
+ * sequence number, which tells producers and consumers if the slot is free for the lap of their position. A position
+ * is claimed by a compare and swap of the enqueue or dequeue position, so producers and consumers only contend on the
+ * position of their own side. The elements are constructed in place in the slot by a push and destroyed by a pop.
+ *
+ * Each successful push notifies the associated inputs like a push of the channel. So each element activates the
+ * consumer inputs once, even when several producers push at the same time.
+ *
+ * @tparam T Data type of the elements. The type shall be copy constructible.
+ * @tparam size Number of elements in the queue. It must be a power of two and at least two.
+ */
+template<typename T, size_t size>
+class MpmcQueue : public Channel
+{
+public:
+    /**
+     * Initialize an empty queue.
+     * @param channelId Identification of the channel.
+     */
+    explicit MpmcQueue(ChannelId channelId = 0);
+
+    /**
+     * Initialize an empty queue.
+     * @param channelName Name of the channel.
+     */
+    explicit MpmcQueue(const char* channelName);
+
+    /// Destroy the elements left in the queue
+    ~MpmcQueue(void) override;
+
+    // Disabling copy constructor
+    MpmcQueue(const MpmcQueue&) = delete;
+    // Disabling assignment operator
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * Construct a copy of data in the queue and notify the associated inputs. Can be called by several producers
+     * at the same time.
+     *
+     * @param data Data to copy into the queue.
+     * @result True if the data is pushed, false if the queue is full.
+     */
+    bool tryPush(const T& data);
+
+    /**
+     * Take the oldest element out of the queue. Can be called by several consumers at the same time.
+     *
+     * @param data [out] Reference to move the oldest element to.
+     * @result True if an element is taken, false if the queue is empty.
+     */
+    bool tryPop(T& data);
+
+    /// @result True if the queue had no element at the time of the call.
+    bool isEmpty(void) const;
+
+protected:
+    using Tasking::Channel::push;
+
+    /// Slot of the queue with its sequence number and the storage of one element
+    struct Cell
+    {
+        /// Position for which the slot is free to push, or position plus one when the slot is filled.
+        std::atomic<size_t> sequence;
+
+        /// Storage of the element
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    };
+
+    /// Mask to compute the slot of a position
+    static const size_t mask = size - 1u;
+
+    /// Slots of the queue
+    Cell cells[size];
+
+    /// Padding to place the enqueue position in another cache line than the slots
+    char cellsPadding[cacheLineSize];
+
+    /// Position of the next push
+    std::atomic<size_t> enqueuePosition;
+
+    /// Padding to place the dequeue position in another cache line than the enqueue position
+    char enqueuePadding[cacheLineSize - sizeof(std::atomic<size_t>)];
+
+    /// Position of the next pop
+    std::atomic<size_t> dequeuePosition;
+
+    /// Padding to place following data in another cache line than the dequeue position
+    char dequeuePadding[cacheLineSize - sizeof(std::atomic<size_t>)];
+
+private:
+    /// Initialize the sequence numbers of the slots.
+    void initialize(void);
+};
+
+// ----- Implementation part -----
+
+template<typename T, size_t size>
+MpmcQueue<T, size>::MpmcQueue(const ChannelId channelId) :
+    Channel(channelId), enqueuePosition(0u), dequeuePosition(0u)
+{
+    initialize();
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+MpmcQueue<T, size>::MpmcQueue(const char* channelName) :
+    Channel(channelName), enqueuePosition(0u), dequeuePosition(0u)
+{
+    initialize();
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+MpmcQueue<T, size>::~MpmcQueue(void)
+{
+    // No producer or consumer accesses the queue anymore
+    size_t end = enqueuePosition.load(std::memory_order_acquire);
+    for (size_t position = dequeuePosition.load(std::memory_order_acquire); position != end; ++position)
+    {
+        reinterpret_cast<T*>(&cells[position & mask].storage)->~T();
+    }
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+void
+MpmcQueue<T, size>::initialize(void)
+{
+    static_assert((size > 1u) && ((size & (size - 1u)) == 0u), "Size of the queue must be a power of two");
+    static_assert(std::is_copy_constructible<T>::value, "Type needs a copy constructor");
+    for (size_t i = 0u; i < size; ++i)
+    {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+bool
+MpmcQueue<T, size>::tryPush(const T& data)
+{
+    Cell* cell = nullptr;
+    size_t position = enqueuePosition.load(std::memory_order_relaxed);
+    bool full = false;
+    while ((cell == nullptr) && !full)
+    {
+        Cell* candidate = &cells[position & mask];
+        size_t sequence = candidate->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (difference == 0)
+        {
+            // Slot is free for this lap, claim the position
+            if (enqueuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+            {
+                cell = candidate;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Slot is still filled from the previous lap
+            full = true;
+        }
+        else
+        {
+            // Another producer claimed the position
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+    if (cell != nullptr)
+    {
+        new (&cell->storage) T(data);
+        // Publish the element before the inputs are notified
+        cell->sequence.store(position + 1u, std::memory_order_release);
+        Channel::pushData(&data, sizeof(T));
+    }
+    return cell != nullptr;
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+bool
+MpmcQueue<T, size>::tryPop(T& data)
+{
+    Cell* cell = nullptr;
+    size_t position = dequeuePosition.load(std::memory_order_relaxed);
+    bool empty = false;
+    while ((cell == nullptr) && !empty)
+    {
+        Cell* candidate = &cells[position & mask];
+        size_t sequence = candidate->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1u);
+        if (difference == 0)
+        {
+            // Slot is filled for this lap, claim the position
+            if (dequeuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+            {
+                cell = candidate;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Slot is not filled yet
+            empty = true;
+        }
+        else
+        {
+            // Another consumer claimed the position
+            position = dequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+    if (cell != nullptr)
+    {
+        T* element = reinterpret_cast<T*>(&cell->storage);
+        data = static_cast<T&&>(*element);
+        element->~T();
+        // Free the slot for the next lap
+        cell->sequence.store(position + mask + 1u, std::memory_order_release);
+    }
+    return cell != nullptr;
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+bool
+MpmcQueue<T, size>::isEmpty(void) const
+{
+    size_t position = dequeuePosition.load(std::memory_order_acquire);
+    return cells[position & mask].sequence.load(std::memory_order_acquire) != (position + 1u);
+}
+
+} // namespace Tasking
+
+#endif /* CHANNELS_INCLUDE_CHANNELS_MPMCQUEUE_H_ */
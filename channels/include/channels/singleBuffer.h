@@ -151,7 +151,7 @@ SingleBuffer<T>::send(const T inData)
 
     // Call convert it to data so reference call can be used.
     data = inData;
-    push();
+    pushData(&data, sizeof(T));
 }
 
 // ------------------------------------
@@ -164,7 +164,7 @@ SingleBuffer<T>::send(const T* inData)
     {
         data = *inData;
     }
-    push();
+    pushData(&data, sizeof(T));
 }
 
 // ------------------------------------
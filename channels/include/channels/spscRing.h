@@ -0,0 +1,199 @@
+/*
+ * spscRing.h
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHANNELS_INCLUDE_CHANNELS_SPSCRING_H_
+#define CHANNELS_INCLUDE_CHANNELS_SPSCRING_H_
+
+#include <atomic>
+#include <stddef.h>
+#include <type_traits>
+
+#include <taskChannel.h>
+
+#include "cacheLine.h"
+
+namespace Tasking
+{
+
+/**
+ * Lock-free ring buffer channel for one producer and one consumer. The producer and the consumer may run in
+ * different executors at the same time without any lock. Each successful push notifies the associated inputs like a
+ * push of the channel. The head index of the consumer and the tail index of the producer are placed in different
+ * cache lines, and each side caches the last seen index of the other side to avoid sharing of cache lines.
+ *
+ * Only one task shall push and only one task shall pop at the same time. For several producers or consumers use a
+ * Fifo.
+ *
+ * @tparam T Data type of the elements. The type shall support an assignment operator.
+ * @tparam size Number of elements in the ring. It must be a power of two.
+ */
+template<typename T, size_t size>
+class SpscRing : public Channel
+{
+public:
+    /**
+     * Initialize an empty ring.
+     * @param channelId Identification of the channel.
+     */
+    explicit SpscRing(ChannelId channelId = 0);
+
+    /**
+     * Initialize an empty ring.
+     * @param channelName Name of the channel.
+     */
+    explicit SpscRing(const char* channelName);
+
+    /**
+     * Copy data into the ring and notify associated inputs. Only called by the producer.
+     *
+     * @param data Data to copy into the ring.
+     * @result True if the data is pushed, false if the ring is full.
+     */
+    bool push(const T& data);
+
+    /**
+     * Take the oldest element out of the ring. Only called by the consumer.
+     *
+     * @param data [out] Reference to copy the oldest element to.
+     * @result True if an element is taken, false if the ring is empty.
+     */
+    bool pop(T& data);
+
+    /// @result True if the ring has no element to pop.
+    bool isEmpty(void) const;
+
+    /// @result Number of elements in the ring.
+    size_t getCount(void) const;
+
+protected:
+    using Tasking::Channel::push;
+
+    /// Mask to compute the position of an index in the ring
+    static const size_t mask = size - 1u;
+
+    /// Index of the next element to write, only written by the producer.
+    std::atomic<size_t> tail;
+
+    /// Last read value of the head index by the producer
+    size_t cachedHead;
+
+    /// Padding to place the head in another cache line than the tail
+    char tailPadding[cacheLineSize - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+    /// Index of the next element to read, only written by the consumer.
+    std::atomic<size_t> head;
+
+    /// Last read value of the tail index by the consumer
+    size_t cachedTail;
+
+    /// Padding to place the elements in another cache line than the head
+    char headPadding[cacheLineSize - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+    /// Storage of the elements
+    T m_data[size];
+};
+
+// ----- Implementation part -----
+
+template<typename T, size_t size>
+SpscRing<T, size>::SpscRing(const ChannelId channelId) :
+    Channel(channelId), tail(0u), cachedHead(0u), head(0u), cachedTail(0u)
+{
+    static_assert((size > 0u) && ((size & (size - 1u)) == 0u), "Size of the ring must be a power of two");
+    static_assert(std::is_copy_assignable<T>::value, "Type needs an assignment operator");
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+SpscRing<T, size>::SpscRing(const char* channelName) :
+    Channel(channelName), tail(0u), cachedHead(0u), head(0u), cachedTail(0u)
+{
+    static_assert((size > 0u) && ((size & (size - 1u)) == 0u), "Size of the ring must be a power of two");
+    static_assert(std::is_copy_assignable<T>::value, "Type needs an assignment operator");
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+bool
+SpscRing<T, size>::push(const T& data)
+{
+    bool result = false;
+    const size_t currentTail = tail.load(std::memory_order_relaxed);
+    // Read the head of the consumer only when the ring seems to be full
+    if ((currentTail - cachedHead) == size)
+    {
+        cachedHead = head.load(std::memory_order_acquire);
+    }
+    if ((currentTail - cachedHead) != size)
+    {
+        m_data[currentTail & mask] = data;
+        // Publish the element before the inputs are notified
+        tail.store(currentTail + 1u, std::memory_order_release);
+        Channel::pushData(&data, sizeof(T));
+        result = true;
+    }
+    return result;
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+bool
+SpscRing<T, size>::pop(T& data)
+{
+    bool result = false;
+    const size_t currentHead = head.load(std::memory_order_relaxed);
+    // Read the tail of the producer only when the ring seems to be empty
+    if (currentHead == cachedTail)
+    {
+        cachedTail = tail.load(std::memory_order_acquire);
+    }
+    if (currentHead != cachedTail)
+    {
+        data = m_data[currentHead & mask];
+        // Free the element for the producer
+        head.store(currentHead + 1u, std::memory_order_release);
+        result = true;
+    }
+    return result;
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+bool
+SpscRing<T, size>::isEmpty(void) const
+{
+    return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+}
+
+// ------------------------------------
+
+template<typename T, size_t size>
+size_t
+SpscRing<T, size>::getCount(void) const
+{
+    const size_t currentHead = head.load(std::memory_order_acquire);
+    return tail.load(std::memory_order_acquire) - currentHead;
+}
+
+} // namespace Tasking
+
+#endif /* CHANNELS_INCLUDE_CHANNELS_SPSCRING_H_ */
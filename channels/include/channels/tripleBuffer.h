@@ -0,0 +1,270 @@
+/*
+ * tripleBuffer.h
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHANNELS_INCLUDE_CHANNELS_TRIPLEBUFFER_H_
+#define CHANNELS_INCLUDE_CHANNELS_TRIPLEBUFFER_H_
+
+#include <atomic>
+#include <stddef.h>
+#include <type_traits>
+
+#include <taskChannel.h>
+
+namespace Tasking
+{
+
+/**
+ * Wait-free channel with a triple buffer for one writing task and one reading task, which may run at the same time
+ * in different executors. The writer owns the back buffer and the reader owns the front buffer. The third buffer is
+ * exchanged atomically between them. A send writes the back buffer and exchanges it with the third buffer, a read
+ * exchanges the front buffer with the third buffer when newer data was sent. So the reader always sees a consistent
+ * element and neither side waits on the other.
+ *
+ * Elements sent between two reads are overwritten, the reader only gets the latest one.
+ *
+ * @tparam T Data type of the channel. The data type needs a default constructor and shall support an assignment
+ * operator.
+ */
+template<typename T>
+class TripleBuffer : public Channel
+{
+public:
+    /**
+     * Default Constructor.
+     *
+     * @param channelId Identification of the channel.
+     */
+    TripleBuffer(const ChannelId channelId = 0);
+
+    /**
+     * Default Constructor.
+     *
+     * @param channelName Name of the channel.
+     */
+    TripleBuffer(const char* channelName);
+
+    /**
+     * Constructor with assignment of initial data in the buffer.
+     *
+     * @param initialValue Data for all elements in the triple buffer.
+     * @param channelId Identification of the channel.
+     */
+    TripleBuffer(const T initialValue, const ChannelId channelId = 0);
+
+    /**
+     * Constructor with assignment of initial data in the buffer and a channel name.
+     *
+     * @param initialValue Data for all elements in the triple buffer.
+     * @param channelName Name of the channel.
+     */
+    TripleBuffer(const T initialValue, const char* channelName);
+
+    /**
+     * Read the latest data from the channel. Only called by the reading task. The reference stays valid and
+     * unchanged until the next read.
+     *
+     * @result Reference to the front buffer.
+     */
+    const T& read(void);
+
+    /// @result True if data was sent after the last read.
+    bool isUpdated(void) const;
+
+    /**
+     * Send data over the channel. Only called by the writing task.
+     *
+     * @param data Data to send.
+     */
+    void send(const T& data);
+
+    /**
+     * Send data over the channel. Only called by the writing task.
+     *
+     * @param data Data to send. If the pointer is the back buffer provided by getBuffer, no copy operation is
+     * performed, only the buffers are exchanged.
+     *
+     * @see getBuffer
+     */
+    void send(const T* data);
+
+    /**
+     * Get the pointer to the back buffer. The writing task can fill it and send it without copying. The pointer is
+     * valid until the next send.
+     *
+     * @return Pointer to the back buffer.
+     *
+     * @see send
+     */
+    T* getBuffer(void);
+
+protected:
+    /// Constant for the dimension of the buffer
+    static const unsigned int bufferSize = 3u;
+
+    /// Mask of the buffer index in the exchanged state
+    static const unsigned int indexMask = 0x3u;
+
+    /// Flag in the exchanged state for data which was not read yet
+    static const unsigned int updatedFlag = 0x4u;
+
+    /// Exchange the back buffer with the third buffer and notify the associated inputs.
+    void publish(void);
+
+    /// Buffer for three data elements
+    T data[bufferSize];
+
+    /// Index of the back buffer, only used by the writer.
+    unsigned int backIndex;
+
+    /// Index of the front buffer, only used by the reader.
+    unsigned int frontIndex;
+
+    /// Index of the third buffer with the updated flag, exchanged between writer and reader.
+    std::atomic<unsigned int> middle;
+
+private:
+    /**
+     * Initialize buffer with data. Called by constructors with initialization.
+     *
+     * @param initialValue Data for all elements in the triple buffer.
+     */
+    void initBuffer(const T initialValue);
+};
+
+// ----- Implementation part -----
+
+template<typename T>
+TripleBuffer<T>::TripleBuffer(const ChannelId channelId) :
+    Channel(channelId), backIndex(0u), frontIndex(1u), middle(2u)
+{
+    static_assert(std::is_default_constructible<T>::value, "Type needs to be default constructible");
+}
+
+// ------------------------------------
+
+template<typename T>
+TripleBuffer<T>::TripleBuffer(const char* channelName) :
+    Channel(channelName), backIndex(0u), frontIndex(1u), middle(2u)
+{
+    static_assert(std::is_default_constructible<T>::value, "Type needs to be default constructible");
+}
+
+// ------------------------------------
+
+template<typename T>
+TripleBuffer<T>::TripleBuffer(const T initialValue, const ChannelId channelId) :
+    Channel(channelId), backIndex(0u), frontIndex(1u), middle(2u)
+{
+    static_assert(std::is_default_constructible<T>::value, "Type needs to be default constructible");
+    initBuffer(initialValue);
+}
+
+// ------------------------------------
+
+template<typename T>
+TripleBuffer<T>::TripleBuffer(const T initialValue, const char* channelName) :
+    Channel(channelName), backIndex(0u), frontIndex(1u), middle(2u)
+{
+    static_assert(std::is_default_constructible<T>::value, "Type needs to be default constructible");
+    initBuffer(initialValue);
+}
+
+// ------------------------------------
+
+template<typename T>
+void
+TripleBuffer<T>::initBuffer(const T initialValue)
+{
+    static_assert(std::is_copy_assignable<T>::value, "Type needs an assignment operator");
+    for (unsigned int index = 0u; index < bufferSize; ++index)
+    {
+        data[index] = initialValue;
+    }
+}
+
+// ------------------------------------
+
+template<typename T>
+const T&
+TripleBuffer<T>::read(void)
+{
+    // Take the third buffer only when it holds newer data than the front buffer
+    if ((middle.load(std::memory_order_relaxed) & updatedFlag) != 0u)
+    {
+        frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & indexMask;
+    }
+    return data[frontIndex];
+}
+
+// ------------------------------------
+
+template<typename T>
+bool
+TripleBuffer<T>::isUpdated(void) const
+{
+    return (middle.load(std::memory_order_acquire) & updatedFlag) != 0u;
+}
+
+// ------------------------------------
+
+template<typename T>
+void
+TripleBuffer<T>::send(const T& inData)
+{
+    data[backIndex] = inData;
+    publish();
+}
+
+// ------------------------------------
+
+template<typename T>
+void
+TripleBuffer<T>::send(const T* inData)
+{
+    // Copy only if inData is not the back buffer
+    if (inData != data + backIndex)
+    {
+        data[backIndex] = *inData;
+    }
+    publish();
+}
+
+// ------------------------------------
+
+template<typename T>
+T*
+TripleBuffer<T>::getBuffer(void)
+{
+    return (data + backIndex);
+}
+
+// ------------------------------------
+
+template<typename T>
+void
+TripleBuffer<T>::publish(void)
+{
+    // The back buffer becomes the third buffer with newer data, the former third buffer becomes the back buffer.
+    const T* sent = data + backIndex;
+    backIndex = middle.exchange(backIndex | updatedFlag, std::memory_order_acq_rel) & indexMask;
+    pushData(sent, sizeof(T));
+}
+
+} // namespace Tasking
+
+#endif /* CHANNELS_INCLUDE_CHANNELS_TRIPLEBUFFER_H_ */
@@ -23,7 +23,7 @@
 using Tasking::FifoGeneric;
 using Tasking::FifoGenericReader;
 
-FifoGenericReader::FifoGenericReader(Tasking::Task* p_task) :
+FifoGenericReader::FifoGenericReader(Tasking::Task* p_task, Chain* p_links, const unsigned int p_numberOfLinks) :
     nextReader(nullptr),
     readerId(0),
     readerTask(p_task),
@@ -31,21 +31,11 @@ FifoGenericReader::FifoGenericReader(Tasking::Task* p_task) :
     fifo_first(nullptr),
     fifo_last(nullptr),
     allocated_elements(nullptr),
-    unusedLinks(nullptr)
+    unusedLinks(nullptr),
+    linkPool(p_links),
+    linkPoolSize(p_numberOfLinks),
+    usedLinks(0u)
 {
-
-    // Check if list of unused links is initialized and initialize it if necessary.
-    linkMutex.enter();
-    if (unusedLinks == nullptr)
-    {
-        for (unsigned int i = 0; i < maximumFifoReaderLinks - 1; i++)
-        {
-            links[i].next = &(links[i + 1]);
-        }
-        links[maximumFifoReaderLinks - 1].next = nullptr;
-        unusedLinks = links;
-    }
-    linkMutex.leave();
 }
 
 // -------------------
@@ -122,6 +112,12 @@ FifoGenericReader::pop(void)
     {
         unusedLinks = unusedLinks->next;
     }
+    else if (usedLinks < linkPoolSize)
+    {
+        // Take a link from the pool which was never used before
+        link = linkPool + usedLinks;
+        usedLinks++;
+    }
     linkMutex.leave();
     if (link == nullptr)
     {
@@ -168,7 +164,13 @@ FifoGenericReader::releaseAll(void)
 
 // -------------------
 
-FifoGeneric::FifoGeneric(FifoGeneric::Chain* chain, void* dataBuffer, const size_t size, const unsigned int items) :
+FifoGeneric::FifoGeneric(FifoGeneric::Chain* chain, void* dataBuffer, const size_t size, const unsigned int items,
+                         ResetFunction reset) :
+    m_chain(chain),
+    m_dataBuffer(reinterpret_cast<char*>(dataBuffer)),
+    m_itemSize(size),
+    m_items(items),
+    m_reset(reset),
     m_unused(nullptr),
     m_allocated(nullptr),
     m_fifo_first(nullptr),
@@ -181,8 +183,11 @@ FifoGeneric::FifoGeneric(FifoGeneric::Chain* chain, void* dataBuffer, const size
     char* cDataBuffer = reinterpret_cast<char*>(dataBuffer);
     for (unsigned int i = 0; i < items; i++)
     {
+        // The chain element of a data item has the same index as the data item, see findAllocated
         chain[i].data = cDataBuffer + (size * i);
         chain[i].next = m_unused;
+        chain[i].previous = nullptr;
+        chain[i].allocated = false;
         m_unused = chain + i;
     }
 }
@@ -199,9 +204,8 @@ FifoGeneric::allocate(void)
     {
         // Remove from unused list and insert in allocated list.
         m_unused = m_unused->next;
-        element->next = m_allocated;
         element->expectedReadsBitMask = (1 << 0);
-        m_allocated = element;
+        linkAllocated(element);
         // Result is the corresponding data element.
         result = element->data;
     }
@@ -218,34 +222,20 @@ FifoGeneric::release(const void* data, unsigned int readerId)
     if (m_allocated != nullptr)
     {
         m_mutex.enter(); // Should synchronize with other access to object
-        // Is data item in the head element of allocated list?
-        if (m_allocated->data == data)
+        Chain* removeItem = findAllocated(data);
+        // Have we found the data item, than release it by remove it from allocate list and put it to unused list
+        if (removeItem != nullptr)
         {
-            // Release data
-            Chain* removeItem = m_allocated;
             removeItem->expectedReadsBitMask &= ~readerId;
             if (removeItem->expectedReadsBitMask == 0)
             {
-                m_allocated = removeItem->next;
-                removeItem->next = m_unused;
-                m_unused = removeItem;
-            }
-        }
-        else
-        {
-            // Search data item in list
-            Chain* previous = findPrevious(data);
-            // Have we found the data item, than release it by remove it from allocate list and put it to unused list
-            if (previous != nullptr)
-            {
-                Chain* removeItem = previous->next;
-                removeItem->expectedReadsBitMask &= ~readerId;
-                if (removeItem->expectedReadsBitMask == 0)
+                if (m_reset != nullptr)
                 {
-                    previous->next = removeItem->next;
-                    removeItem->next = m_unused;
-                    m_unused = removeItem;
+                    m_reset(removeItem->data);
                 }
+                unlinkAllocated(removeItem);
+                removeItem->next = m_unused;
+                m_unused = removeItem;
             }
         }
         m_mutex.leave();
@@ -267,40 +257,14 @@ FifoGeneric::releaseElement(FifoGeneric::Chain* link, unsigned int readerId)
         link->expectedReadsBitMask &= ~readerId;
         if (link->expectedReadsBitMask == 0)
         {
-            // Search element in FIFO
-            if (link == m_fifo_first)
-            {
-                // Head of FIFO
-                m_fifo_first = link->next;
-                link->next = m_unused;
-                m_unused = link;
-                if (m_fifo_last == link)
-                {
-                    m_fifo_last = nullptr;
-                }
-            }
-            else
+            // The last reader released the element, so no reader accesses the data item anymore
+            if (m_reset != nullptr)
             {
-                // Not head, find previous to remove link from list.
-                Chain* previous = m_fifo_first;
-                while ((previous != nullptr) && (previous->next != link))
-                {
-                    previous = previous->next;
-                }
-                assert(previous != nullptr);
-                // Remove from list if a previous element is found
-                if (previous != nullptr)
-                {
-                    previous->next = link->next;
-                    // Correct last pointer it the element to release is the last one.
-                    if (link == m_fifo_last)
-                    {
-                        m_fifo_last = previous;
-                    }
-                    link->next = m_unused;
-                    m_unused = link;
-                }
+                m_reset(link->data);
             }
+            unlinkFifo(link);
+            link->next = m_unused;
+            m_unused = link;
         }
         m_mutex.leave();
     }
@@ -317,22 +281,11 @@ FifoGeneric::push(const void* data)
     if (m_allocated != nullptr)
     {
         m_mutex.enter(); // Should synchronize against other access to the object
-        // Is data item head element of allocated list?
-        if (m_allocated->data == data)
+        // Find element of the data item and remove it from allocated list
+        element = findAllocated(data);
+        if (element != nullptr)
         {
-            // Remove head element of allocated list
-            element = m_allocated;
-            m_allocated = element->next;
-        }
-        else
-        {
-            // Search element in allocated list and remove it from allocated list
-            Chain* previous = findPrevious(data);
-            if (previous != nullptr)
-            {
-                element = previous->next;
-                previous->next = element->next;
-            }
+            unlinkAllocated(element);
         }
         m_mutex.leave();
     }
@@ -353,6 +306,7 @@ FifoGeneric::push(const void* data)
             m_fifo_first = element;
         }
         // element becomes always last element
+        element->previous = m_fifo_last;
         m_fifo_last = element;
         element->next = nullptr;
         // Remember on last pushed object
@@ -376,15 +330,9 @@ FifoGeneric::pop(void)
     {
         // Consume first element in FIFO
         Chain* element = m_fifo_first;
-        m_fifo_first = element->next;
-        // If last element is consumed in FIFO also no last element exist
-        if (m_fifo_first == nullptr)
-        {
-            m_fifo_last = nullptr;
-        }
+        unlinkFifo(element);
         // Put element in the list of allocated elements
-        element->next = m_allocated;
-        m_allocated = element;
+        linkAllocated(element);
         result = element->data;
     }
     m_mutex.leave();
@@ -410,25 +358,87 @@ FifoGeneric::isEmpty(void) const
 // -------------------
 
 FifoGeneric::Chain*
-FifoGeneric::findPrevious(const void* data) const
+FifoGeneric::findAllocated(const void* data) const
 {
     Chain* result = nullptr;
-    // If head element of allocated list contain the data there is no previous element.
-    if (m_allocated->data != data)
+    // Data items outside of the buffer or not at the start of an item are not provided by the FIFO stack.
+    const char* cData = reinterpret_cast<const char*>(data);
+    if ((cData >= m_dataBuffer) && (cData < m_dataBuffer + (m_itemSize * m_items)))
     {
-        // Iterate over the list until the list ends or the element is found.
-        for (Chain* previous = m_allocated; (previous->next != nullptr) && (result == nullptr);
-             previous = previous->next)
+        size_t offset = static_cast<size_t>(cData - m_dataBuffer);
+        if ((offset % m_itemSize) == 0u)
         {
-            if (previous->next->data == data)
+            Chain* element = m_chain + (offset / m_itemSize);
+            if (element->allocated)
             {
-                result = previous;
+                result = element;
             }
         }
     }
     return result;
 }
 
+// -------------------
+
+void
+FifoGeneric::linkAllocated(FifoGeneric::Chain* element)
+{
+    element->next = m_allocated;
+    element->previous = nullptr;
+    if (m_allocated != nullptr)
+    {
+        m_allocated->previous = element;
+    }
+    m_allocated = element;
+    element->allocated = true;
+}
+
+// -------------------
+
+void
+FifoGeneric::unlinkAllocated(FifoGeneric::Chain* element)
+{
+    if (element->previous != nullptr)
+    {
+        element->previous->next = element->next;
+    }
+    else
+    {
+        // Head of allocated list
+        m_allocated = element->next;
+    }
+    if (element->next != nullptr)
+    {
+        element->next->previous = element->previous;
+    }
+    element->allocated = false;
+}
+
+// -------------------
+
+void
+FifoGeneric::unlinkFifo(FifoGeneric::Chain* element)
+{
+    if (element->previous != nullptr)
+    {
+        element->previous->next = element->next;
+    }
+    else
+    {
+        // Head of FIFO
+        m_fifo_first = element->next;
+    }
+    if (element->next != nullptr)
+    {
+        element->next->previous = element->previous;
+    }
+    else
+    {
+        // Correct last pointer if the element is the last one.
+        m_fifo_last = element->previous;
+    }
+}
+
 // -------------------
 // TODO: this method should have a return value if no new reader can be assigned -> not checked yet
 void
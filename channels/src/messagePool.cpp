@@ -0,0 +1,97 @@
+/*
+ * messagePool.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <channels/messagePool.h>
+
+using Tasking::MessagePoolGeneric;
+
+MessagePoolGeneric::MessagePoolGeneric(Buffer* buffers, void* dataBuffer, const size_t size, const uint32_t items) :
+    m_buffers(buffers), m_freeHead(0u), m_free(items)
+{
+    char* cDataBuffer = reinterpret_cast<char*>(dataBuffer);
+    // Chain all buffers into the free stack, the first buffer is the head of the stack
+    for (uint32_t i = 0u; i < items; i++)
+    {
+        buffers[i].references.store(0u, std::memory_order_relaxed);
+        buffers[i].next.store(((i + 1u) < items) ? (i + 2u) : 0u, std::memory_order_relaxed);
+        buffers[i].pool = this;
+        buffers[i].data = cDataBuffer + (size * i);
+    }
+    m_freeHead.store((items > 0u) ? 1u : 0u, std::memory_order_release);
+}
+
+// -------------------
+
+MessagePoolGeneric::Buffer*
+MessagePoolGeneric::allocate(void)
+{
+    Buffer* result = nullptr;
+    uint64_t head = m_freeHead.load(std::memory_order_acquire);
+    bool empty = false;
+    while ((result == nullptr) && !empty)
+    {
+        uint32_t index = static_cast<uint32_t>(head & indexMask);
+        if (index == 0u)
+        {
+            empty = true;
+        }
+        else
+        {
+            Buffer* candidate = m_buffers + (index - 1u);
+            // The tag in the upper half changes with each change of the head
+            uint64_t newHead = ((head & ~indexMask) + tagIncrement) | candidate->next.load(std::memory_order_relaxed);
+            if (m_freeHead.compare_exchange_weak(head, newHead, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                result = candidate;
+            }
+        }
+    }
+    if (result != nullptr)
+    {
+        m_free.fetch_sub(1u, std::memory_order_relaxed);
+        result->references.store(1u, std::memory_order_relaxed);
+    }
+    return result;
+}
+
+// -------------------
+
+void
+MessagePoolGeneric::release(Buffer* buffer)
+{
+    const uint32_t index = static_cast<uint32_t>(buffer - m_buffers) + 1u;
+    // Count before the push and after the pop of allocate, so the number never drops below zero
+    m_free.fetch_add(1u, std::memory_order_relaxed);
+    uint64_t head = m_freeHead.load(std::memory_order_relaxed);
+    bool released = false;
+    while (!released)
+    {
+        buffer->next.store(static_cast<uint32_t>(head & indexMask), std::memory_order_relaxed);
+        uint64_t newHead = ((head & ~indexMask) + tagIncrement) | index;
+        released =
+            m_freeHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed);
+    }
+}
+
+// -------------------
+
+uint32_t
+MessagePoolGeneric::getNumberOfFreeBuffers(void) const
+{
+    return m_free.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,216 @@
+/*
+ * testBroadcastRing.cpp
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+#include <channels/broadcastRing.h>
+#include <task.h>
+#include <schedulerUnitTest.h>
+#include <schedulePolicyLifo.h>
+
+using Tasking::BroadcastReader;
+using Tasking::BroadcastRing;
+
+class TestBroadcastRing : public ::testing::Test
+{
+public:
+    typedef BroadcastRing<int, 4u> Ring;
+
+    class TestTask : public Tasking::TaskProvider<1, Tasking::SchedulePolicyLifo>
+    {
+    public:
+        /// Configure task with 1 input with one necessary push on related channel and not final
+        TestTask(Tasking::Scheduler& p_scheduler, Ring& ring) :
+            TaskProvider<1, Tasking::SchedulePolicyLifo>(p_scheduler), reader(ring), executions(0u), sum(0)
+        {
+            inputs[0].configure(1, false);
+            configureInput(0, ring);
+        }
+        void
+        execute(void) override
+        {
+            executions++;
+            int value;
+            while (reader.pop(value))
+            {
+                sum += value;
+            }
+        }
+        BroadcastReader<int, 4u> reader;
+        unsigned int executions;
+        int sum;
+    };
+
+    TestBroadcastRing(void) : scheduler(policy), task1(scheduler, channel), task2(scheduler, channel)
+    {
+        scheduler.start();
+    }
+
+protected:
+    Tasking::SchedulePolicyLifo policy;
+    Tasking::SchedulerUnitTest scheduler;
+    Ring channel;
+    TestTask task1;
+    TestTask task2;
+};
+
+TEST_F(TestBroadcastRing, construction)
+{
+    BroadcastRing<int, 2u> ringWithId(1726u);
+    EXPECT_EQ(1726u, ringWithId.getChannelId());
+    BroadcastRing<int, 2u> ringWithName("HoHo");
+    EXPECT_EQ(0x486F486Fu, ringWithName.getChannelId());
+    EXPECT_EQ(0u, ringWithName.getNumberOfReaders());
+}
+
+TEST_F(TestBroadcastRing, everyReaderReadsAllElements)
+{
+    Ring ring;
+    BroadcastReader<int, 4u> reader1(ring);
+    BroadcastReader<int, 4u> reader2(ring);
+    EXPECT_EQ(2u, ring.getNumberOfReaders());
+    EXPECT_TRUE(ring.push(1));
+    EXPECT_TRUE(ring.push(2));
+    EXPECT_EQ(2u, reader1.getCount());
+    int value = 0;
+    for (int expected = 1; expected <= 2; ++expected)
+    {
+        EXPECT_TRUE(reader1.pop(value));
+        EXPECT_EQ(expected, value);
+    }
+    EXPECT_TRUE(reader1.isEmpty());
+    EXPECT_FALSE(reader1.pop(value));
+    for (int expected = 1; expected <= 2; ++expected)
+    {
+        EXPECT_TRUE(reader2.pop(value));
+        EXPECT_EQ(expected, value);
+    }
+    EXPECT_TRUE(reader2.isEmpty());
+}
+
+TEST_F(TestBroadcastRing, slowestReaderLimitsProducer)
+{
+    Ring ring;
+    BroadcastReader<int, 4u> fastReader(ring);
+    BroadcastReader<int, 4u> slowReader(ring);
+    int value = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ring.push(i));
+        EXPECT_TRUE(fastReader.pop(value));
+    }
+    EXPECT_FALSE(ring.push(4));
+    // The slow reader frees one slot
+    EXPECT_TRUE(slowReader.pop(value));
+    EXPECT_EQ(0, value);
+    EXPECT_TRUE(ring.push(4));
+    EXPECT_FALSE(ring.push(5));
+    for (int i = 1; i < 5; ++i)
+    {
+        EXPECT_TRUE(slowReader.pop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_TRUE(fastReader.pop(value));
+    EXPECT_EQ(4, value);
+}
+
+TEST_F(TestBroadcastRing, readerAttachAndDetach)
+{
+    Ring ring;
+    // Without readers the ring never becomes full
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_TRUE(ring.push(i));
+    }
+    int value = 0;
+    {
+        BroadcastReader<int, 4u> reader(ring);
+        // A new reader starts with the next pushed element
+        EXPECT_TRUE(reader.isEmpty());
+        EXPECT_TRUE(ring.push(10));
+        EXPECT_TRUE(reader.pop(value));
+        EXPECT_EQ(10, value);
+        for (int i = 11; i < 15; ++i)
+        {
+            EXPECT_TRUE(ring.push(i));
+        }
+        EXPECT_FALSE(ring.push(15));
+    }
+    // A destroyed reader does not hold back the producer
+    EXPECT_EQ(0u, ring.getNumberOfReaders());
+    EXPECT_TRUE(ring.push(15));
+}
+
+TEST_F(TestBroadcastRing, pushActivatesAllTasks)
+{
+    EXPECT_TRUE(channel.push(3));
+    EXPECT_TRUE(channel.push(4));
+    scheduler.schedule();
+    EXPECT_EQ(7, task1.sum);
+    EXPECT_EQ(7, task2.sum);
+    EXPECT_LE(1u, task1.executions);
+    EXPECT_LE(1u, task2.executions);
+    EXPECT_TRUE(task1.reader.isEmpty());
+    EXPECT_TRUE(task2.reader.isEmpty());
+}
+
+TEST_F(TestBroadcastRing, concurrentProducerAndReaders)
+{
+    static const unsigned int numberOfReaders = 3u;
+    static const unsigned int numberOfElements = 20000u;
+    BroadcastRing<unsigned int, 64u> ring;
+    BroadcastReader<unsigned int, 64u> reader0(ring);
+    BroadcastReader<unsigned int, 64u> reader1(ring);
+    BroadcastReader<unsigned int, 64u> reader2(ring);
+    BroadcastReader<unsigned int, 64u>* readers[numberOfReaders] = {&reader0, &reader1, &reader2};
+    bool inOrder[numberOfReaders] = {true, true, true};
+    std::thread threads[numberOfReaders];
+    for (unsigned int i = 0u; i < numberOfReaders; ++i)
+    {
+        threads[i] = std::thread([&readers, &inOrder, i]() {
+            for (unsigned int expected = 0u; expected < numberOfElements;)
+            {
+                unsigned int value;
+                if (readers[i]->pop(value))
+                {
+                    inOrder[i] = inOrder[i] && (value == expected);
+                    ++expected;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (unsigned int i = 0u; i < numberOfElements; ++i)
+    {
+        while (!ring.push(i))
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (unsigned int i = 0u; i < numberOfReaders; ++i)
+    {
+        threads[i].join();
+        EXPECT_TRUE(inOrder[i]);
+        EXPECT_TRUE(readers[i]->isEmpty());
+    }
+}
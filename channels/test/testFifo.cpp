@@ -258,3 +258,68 @@ TEST_F(TestFifo, reuisingUnusedElements)
     EXPECT_EQ(5, *data);
     fifo.release(data);
 }
+
+TEST_F(TestFifo, outOfOrderPushAndRelease)
+{
+    Fifo<int, 4> fifo;
+    int* data[4];
+    for (int i = 0; i < 4; i++)
+    {
+        data[i] = fifo.allocate();
+        *data[i] = i;
+    }
+    // Push and release from the middle of the allocated elements
+    EXPECT_TRUE(fifo.push(data[2]));
+    EXPECT_TRUE(fifo.push(data[0]));
+    fifo.release(data[1]);
+    // Second push and release of an element are ignored
+    EXPECT_FALSE(fifo.push(data[2]));
+    fifo.release(data[1]);
+    EXPECT_TRUE(fifo.push(data[3]));
+    // Only the released element is allocated again
+    EXPECT_TRUE(data[1] == fifo.allocate());
+    EXPECT_TRUE(nullptr == fifo.allocate());
+    int* result = fifo.pop();
+    ASSERT_FALSE(nullptr == result);
+    EXPECT_EQ(2, *result);
+    fifo.release(result);
+    result = fifo.pop();
+    ASSERT_FALSE(nullptr == result);
+    EXPECT_EQ(0, *result);
+    result = fifo.pop();
+    ASSERT_FALSE(nullptr == result);
+    EXPECT_EQ(3, *result);
+    EXPECT_TRUE(nullptr == fifo.pop());
+}
+
+TEST_F(TestFifo, releaseInsideOfElement)
+{
+    Fifo<int32_t, 2> fifo;
+    int32_t* data = fifo.allocate();
+    // A pointer into the data item is not the start of an item
+    fifo.release(reinterpret_cast<int32_t*>(reinterpret_cast<char*>(data) + 1));
+    EXPECT_FALSE(nullptr == fifo.allocate());
+    EXPECT_TRUE(nullptr == fifo.allocate());
+    fifo.release(data);
+    EXPECT_TRUE(data == fifo.allocate());
+}
+
+TEST_F(TestFifo, pushBatch)
+{
+    Fifo<int, 4> fifo;
+    int values[5] = {1, 2, 3, 4, 5};
+    EXPECT_EQ(0u, fifo.pushBatch(values, 0u));
+    EXPECT_TRUE(fifo.isEmpty());
+    EXPECT_EQ(2u, fifo.pushBatch(values, 2u));
+    // Only the free elements are pushed
+    EXPECT_EQ(2u, fifo.pushBatch(values + 2, 3u));
+    EXPECT_TRUE(nullptr == fifo.allocate());
+    for (int i = 1; i <= 4; i++)
+    {
+        int* data = fifo.pop();
+        ASSERT_FALSE(nullptr == data);
+        EXPECT_EQ(i, *data);
+        fifo.release(data);
+    }
+    EXPECT_TRUE(fifo.isEmpty());
+}
@@ -40,6 +40,8 @@ public:
         execute(void) override
         {
         }
+        /// Provide access to inputs for testing
+        using TaskProvider::inputs;
     };
 
     // Make protected stuff public
@@ -54,11 +56,11 @@ public:
     Tasking::SchedulerUnitTest scheduler;
     TestFifo fifo;
     Tasking::InputArrayProvider<3> inputs;
-    Tasking::FifoReader<int8_t> reader1;
+    TestFifo::Reader reader1;
     TestTask task1;
-    Tasking::FifoReader<int8_t> reader2;
+    TestFifo::Reader reader2;
     TestTask task2;
-    Tasking::FifoReader<int8_t> reader3;
+    TestFifo::Reader reader3;
     TestTask task3;
 
     TestFifoReader(void) :
@@ -604,3 +606,53 @@ TEST_F(TestFifoReader, ReaderReleaseShuffled)
     temp2 = fifo.allocate();
     EXPECT_EQ(2, *temp2);
 }
+
+TEST_F(TestFifoReader, ReaderWithFewLinks)
+{
+    TestTask task(scheduler);
+    Tasking::FifoReader<int8_t, 2> reader(&task);
+    task.configureInput(0, fifo);
+    fifo.associateReader(reader);
+    for (int i = 1; i <= 3; i++)
+    {
+        fifo.push(i);
+    }
+    fifo.synchronizeStart(&task, 3);
+    int8_t* first = reader.pop();
+    ASSERT_FALSE(nullptr == first);
+    EXPECT_EQ(1, *first);
+    int8_t* second = reader.pop();
+    ASSERT_FALSE(nullptr == second);
+    EXPECT_EQ(2, *second);
+    // All links are used, so no further element can be popped until an element is released
+    EXPECT_TRUE(nullptr == reader.pop());
+    EXPECT_FALSE(reader.isEmpty());
+    reader.release(first);
+    int8_t* third = reader.pop();
+    ASSERT_FALSE(nullptr == third);
+    EXPECT_EQ(3, *third);
+    reader.release(second);
+    reader.release(third);
+    EXPECT_TRUE(reader.isEmpty());
+    fifo.releaseReader(reader);
+}
+
+TEST_F(TestFifoReader, BatchPushNotifiesOnce)
+{
+    task1.inputs[0].configure(1u);
+    fifo.associateReader(reader1);
+    int8_t values[3] = {4, 5, 6};
+    EXPECT_EQ(3u, fifo.pushBatch(values, 3u));
+    // The input of the task is activated by the first notification, the others are pending for the next activations
+    EXPECT_EQ(1u, task1.inputs[0].getNotifications());
+    EXPECT_EQ(2u, task1.inputs[0].getPendingNotifications());
+    fifo.synchronizeStart(&task1, 3);
+    for (int i = 4; i <= 6; i++)
+    {
+        int8_t* data = reader1.pop();
+        ASSERT_FALSE(nullptr == data);
+        EXPECT_EQ(i, *data);
+        reader1.release(data);
+    }
+    EXPECT_TRUE(reader1.isEmpty());
+}
@@ -0,0 +1,140 @@
+/*
+ * testLatestValue.cpp
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+#include <channels/latestValue.h>
+#include <task.h>
+#include <schedulerUnitTest.h>
+#include <schedulePolicyLifo.h>
+
+using Tasking::LatestValue;
+
+class TestLatestValue : public ::testing::Test
+{
+public:
+    class TestTask : public Tasking::TaskProvider<1, Tasking::SchedulePolicyLifo>
+    {
+    public:
+        /// Configure task with 1 input with one necessary push on related channel and not final
+        TestTask(Tasking::Scheduler& p_scheduler) :
+            TaskProvider<1, Tasking::SchedulePolicyLifo>(p_scheduler), readValue(0)
+        {
+            inputs[0].configure(1, false);
+        }
+        void
+        execute(void) override
+        {
+            readValue = getChannel<LatestValue<int>>(0u)->read();
+        }
+        /// By the task read value.
+        int readValue;
+    };
+
+    /// Element which is only consistent when all values are equal
+    struct Triple
+    {
+        unsigned int first;
+        unsigned int second;
+        unsigned int third;
+    };
+
+    TestLatestValue(void) : scheduler(policy), task(scheduler)
+    {
+        task.configureInput(0, channel);
+        scheduler.start();
+    }
+
+protected:
+    Tasking::SchedulePolicyLifo policy;
+    Tasking::SchedulerUnitTest scheduler;
+    TestTask task;
+    LatestValue<int> channel;
+};
+
+TEST_F(TestLatestValue, construction)
+{
+    LatestValue<int> valueWithId(1726u);
+    EXPECT_EQ(1726u, valueWithId.getChannelId());
+    EXPECT_EQ(0, valueWithId.read());
+    LatestValue<int> valueWithName("HoHo");
+    EXPECT_EQ(0x486F486Fu, valueWithName.getChannelId());
+    LatestValue<int> initializedValue(42, "Init");
+    EXPECT_EQ(42, initializedValue.read());
+    EXPECT_EQ(0u, initializedValue.getNumberOfUpdates());
+}
+
+TEST_F(TestLatestValue, readLatestValue)
+{
+    LatestValue<int> latest(0, 1u);
+    latest.send(1);
+    latest.send(2);
+    EXPECT_EQ(2, latest.read());
+    int value = 0;
+    EXPECT_TRUE(latest.tryRead(value));
+    EXPECT_EQ(2, value);
+    EXPECT_EQ(2u, latest.getNumberOfUpdates());
+}
+
+TEST_F(TestLatestValue, sendActivatesTask)
+{
+    channel.send(5);
+    scheduler.schedule();
+    EXPECT_EQ(5, task.readValue);
+}
+
+TEST_F(TestLatestValue, concurrentWriterAndReaders)
+{
+    static const unsigned int numberOfSends = 100000u;
+    static const unsigned int numberOfReaders = 2u;
+    Triple initial = {0u, 0u, 0u};
+    LatestValue<Triple> latest(initial, 1u);
+    std::atomic<bool> done(false);
+    bool consistent[numberOfReaders] = {true, true};
+    std::thread readers[numberOfReaders];
+    for (unsigned int i = 0u; i < numberOfReaders; ++i)
+    {
+        readers[i] = std::thread([&latest, &done, &consistent, i]() {
+            unsigned int last = 0u;
+            while (!done.load())
+            {
+                Triple triple = latest.read();
+                consistent[i] = consistent[i] && (triple.first == triple.second) && (triple.second == triple.third)
+                    && (triple.first >= last);
+                last = triple.first;
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (unsigned int i = 1u; i <= numberOfSends; ++i)
+    {
+        Triple triple = {i, i, i};
+        latest.send(triple);
+    }
+    done = true;
+    for (unsigned int i = 0u; i < numberOfReaders; ++i)
+    {
+        readers[i].join();
+        EXPECT_TRUE(consistent[i]);
+    }
+    EXPECT_EQ(numberOfSends, latest.read().third);
+    EXPECT_EQ(numberOfSends, latest.getNumberOfUpdates());
+}
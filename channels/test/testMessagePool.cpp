@@ -0,0 +1,221 @@
+/*
+ * testMessagePool.cpp
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+#include <channels/doubleBuffer.h>
+#include <channels/fifo.h>
+#include <channels/messagePool.h>
+#include <channels/singleBuffer.h>
+#include <schedulePolicyLifo.h>
+#include <schedulerUnitTest.h>
+#include <task.h>
+
+using Tasking::MessagePool;
+using Tasking::MessageRef;
+
+class TestMessagePool : public ::testing::Test
+{
+public:
+    /// Large message which shall not be copied
+    struct Image
+    {
+        unsigned int frame;
+        unsigned char pixels[1024];
+    };
+
+    typedef MessagePool<Image, 3u> ImagePool;
+
+    typedef Tasking::FifoReader<MessageRef<Image>, 4u> ImageReader;
+
+    /// Task reading the references of a Fifo by its own reader
+    class ReaderTask : public Tasking::TaskProvider<1u, Tasking::SchedulePolicyLifo>
+    {
+    public:
+        explicit ReaderTask(Tasking::Scheduler& scheduler) : TaskProvider(scheduler)
+        {
+        }
+
+        void
+        execute(void) override
+        {
+        }
+    };
+
+    /// Fifo with access to the synchronization of the readers
+    class ImageFifo : public Tasking::Fifo<MessageRef<Image>, 4u>
+    {
+    public:
+        using Tasking::Fifo<MessageRef<Image>, 4u>::synchronizeStart;
+    };
+};
+
+TEST_F(TestMessagePool, allocateAllBuffers)
+{
+    ImagePool pool;
+    EXPECT_EQ(3u, pool.getNumberOfFreeBuffers());
+    MessageRef<Image> first = pool.allocate();
+    MessageRef<Image> second = pool.allocate();
+    MessageRef<Image> third = pool.allocate();
+    EXPECT_TRUE(first.isValid());
+    EXPECT_TRUE(second.isValid());
+    EXPECT_TRUE(third.isValid());
+    EXPECT_FALSE(first.get() == second.get());
+    EXPECT_EQ(0u, pool.getNumberOfFreeBuffers());
+    MessageRef<Image> none = pool.allocate();
+    EXPECT_FALSE(none.isValid());
+    EXPECT_TRUE(nullptr == none.get());
+    Image* image = second.get();
+    second.release();
+    EXPECT_FALSE(second.isValid());
+    // The released buffer is the next allocated one
+    MessageRef<Image> again = pool.allocate();
+    EXPECT_TRUE(image == again.get());
+}
+
+TEST_F(TestMessagePool, lastReferenceReturnsBuffer)
+{
+    ImagePool pool;
+    {
+        MessageRef<Image> image = pool.allocate();
+        image->frame = 7u;
+        MessageRef<Image> copy(image);
+        EXPECT_EQ(2u, image.getReferences());
+        EXPECT_EQ(7u, copy->frame);
+        MessageRef<Image> moved(static_cast<MessageRef<Image>&&>(copy));
+        EXPECT_FALSE(copy.isValid());
+        EXPECT_EQ(2u, moved.getReferences());
+        image = moved;
+        EXPECT_EQ(2u, moved.getReferences());
+        image.release();
+        EXPECT_EQ(1u, moved.getReferences());
+        EXPECT_EQ(2u, pool.getNumberOfFreeBuffers());
+    }
+    EXPECT_EQ(3u, pool.getNumberOfFreeBuffers());
+}
+
+TEST_F(TestMessagePool, forwardThroughFifo)
+{
+    ImagePool pool;
+    Tasking::Fifo<MessageRef<Image>, 4> fifo;
+    MessageRef<Image> image = pool.allocate();
+    image->frame = 42u;
+    EXPECT_TRUE(fifo.push(image));
+    image.release();
+    EXPECT_EQ(2u, pool.getNumberOfFreeBuffers());
+    MessageRef<Image>* element = fifo.pop();
+    ASSERT_FALSE(nullptr == element);
+    EXPECT_EQ(42u, (*element)->frame);
+    // The Fifo releases the reference with the element
+    fifo.release(element);
+    EXPECT_EQ(3u, pool.getNumberOfFreeBuffers());
+}
+
+TEST_F(TestMessagePool, forwardThroughFifoReaders)
+{
+    Tasking::SchedulePolicyLifo policy;
+    Tasking::SchedulerUnitTest scheduler(policy);
+    ReaderTask task1(scheduler);
+    ReaderTask task2(scheduler);
+    ImageReader reader1(&task1);
+    ImageReader reader2(&task2);
+    ImagePool pool;
+    ImageFifo fifo;
+    fifo.associateReader(reader1);
+    fifo.associateReader(reader2);
+
+    for (unsigned int frame = 0u; frame < 1000u; ++frame)
+    {
+        MessageRef<Image> image = pool.allocate();
+        ASSERT_TRUE(image.isValid());
+        image->frame = frame;
+        EXPECT_TRUE(fifo.push(image));
+        image.release();
+        fifo.synchronizeStart(&task1, 1u);
+        fifo.synchronizeStart(&task2, 1u);
+
+        // Both readers share the same element of the Fifo
+        MessageRef<Image>* element1 = reader1.pop();
+        MessageRef<Image>* element2 = reader2.pop();
+        ASSERT_FALSE(nullptr == element1);
+        ASSERT_TRUE(element1 == element2);
+        EXPECT_EQ(frame, (*element1)->frame);
+        EXPECT_EQ(1u, element1->getReferences());
+
+        // The readers release the element at the same time, the last one returns the buffer to the pool
+        std::thread other([&reader2, element2]() { reader2.release(element2); });
+        reader1.release(element1);
+        other.join();
+        EXPECT_EQ(3u, pool.getNumberOfFreeBuffers());
+    }
+}
+
+TEST_F(TestMessagePool, forwardThroughBuffers)
+{
+    ImagePool pool;
+    Tasking::SingleBuffer<MessageRef<Image>> single;
+    Tasking::DoubleBuffer<MessageRef<Image>> twice;
+    MessageRef<Image> image = pool.allocate();
+    Image* data = image.get();
+    single.send(image);
+    twice.send(image);
+    image.release();
+    EXPECT_TRUE(data == single.read().get());
+    EXPECT_TRUE(data == twice.read().get());
+    EXPECT_EQ(2u, single.read().getReferences());
+    // A buffer stays in use until it is overwritten in the channels
+    single.send(MessageRef<Image>());
+    EXPECT_EQ(2u, pool.getNumberOfFreeBuffers());
+    twice.send(MessageRef<Image>());
+    twice.send(MessageRef<Image>());
+    EXPECT_EQ(3u, pool.getNumberOfFreeBuffers());
+}
+
+TEST_F(TestMessagePool, concurrentAllocateAndRelease)
+{
+    static const unsigned int numberOfThreads = 4u;
+    static const unsigned int cycles = 20000u;
+    MessagePool<unsigned int, 8u> pool;
+    bool exclusive[numberOfThreads] = {true, true, true, true};
+    std::thread threads[numberOfThreads];
+    for (unsigned int i = 0u; i < numberOfThreads; ++i)
+    {
+        threads[i] = std::thread([&pool, &exclusive, i]() {
+            for (unsigned int cycle = 0u; cycle < cycles; ++cycle)
+            {
+                MessageRef<unsigned int> message = pool.allocate();
+                if (message.isValid())
+                {
+                    // No other thread owns the buffer at the same time
+                    *message = i;
+                    MessageRef<unsigned int> copy(message);
+                    std::this_thread::yield();
+                    exclusive[i] = exclusive[i] && (*copy == i);
+                }
+            }
+        });
+    }
+    for (unsigned int i = 0u; i < numberOfThreads; ++i)
+    {
+        threads[i].join();
+        EXPECT_TRUE(exclusive[i]);
+    }
+    EXPECT_EQ(8u, pool.getNumberOfFreeBuffers());
+}
@@ -0,0 +1,199 @@
+/*
+ * testMpmcQueue.cpp
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <channels/mpmcQueue.h>
+#include <task.h>
+#include <schedulerUnitTest.h>
+#include <schedulePolicyLifo.h>
+
+using Tasking::MpmcQueue;
+
+class TestMpmcQueue : public ::testing::Test
+{
+public:
+    class TestTask : public Tasking::TaskProvider<1, Tasking::SchedulePolicyLifo>
+    {
+    public:
+        /// Configure task with 1 input with one necessary push on related channel and not final
+        TestTask(Tasking::Scheduler& p_scheduler) :
+            TaskProvider<1, Tasking::SchedulePolicyLifo>(p_scheduler), executions(0u), sum(0)
+        {
+            inputs[0].configure(1, false);
+        }
+        void
+        execute(void) override
+        {
+            executions++;
+            int value;
+            while (getChannel<MpmcQueue<int, 4u>>(0u)->tryPop(value))
+            {
+                sum += value;
+            }
+        }
+        unsigned int executions;
+        int sum;
+    };
+
+    /// Element which counts its living instances
+    class Counted
+    {
+    public:
+        Counted(void) : value(0)
+        {
+            instances++;
+        }
+        Counted(const Counted& other) : value(other.value)
+        {
+            instances++;
+        }
+        ~Counted(void)
+        {
+            instances--;
+        }
+        Counted& operator=(const Counted&) = default;
+        int value;
+        static int instances;
+    };
+
+    TestMpmcQueue(void) : scheduler(policy), task(scheduler)
+    {
+        task.configureInput(0, channel);
+        scheduler.start();
+    }
+
+protected:
+    Tasking::SchedulePolicyLifo policy;
+    Tasking::SchedulerUnitTest scheduler;
+    TestTask task;
+    MpmcQueue<int, 4u> channel;
+};
+
+int TestMpmcQueue::Counted::instances = 0;
+
+TEST_F(TestMpmcQueue, construction)
+{
+    MpmcQueue<int, 2u> queueWithId(1726u);
+    EXPECT_EQ(1726u, queueWithId.getChannelId());
+    MpmcQueue<int, 2u> queueWithName("HoHo");
+    EXPECT_EQ(0x486F486Fu, queueWithName.getChannelId());
+    EXPECT_TRUE(queueWithName.isEmpty());
+}
+
+TEST_F(TestMpmcQueue, fullQueueAndWrapAround)
+{
+    MpmcQueue<int, 4u> queue;
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(value));
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+    EXPECT_FALSE(queue.tryPush(4));
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(0, value);
+    // Next lap of the first slot
+    EXPECT_TRUE(queue.tryPush(4));
+    for (int i = 1; i < 5; ++i)
+    {
+        EXPECT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(queue.tryPop(value));
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST_F(TestMpmcQueue, elementsAreConstructedInPlace)
+{
+    Counted element;
+    {
+        MpmcQueue<Counted, 4u> queue;
+        // Storage of the queue holds no element
+        EXPECT_EQ(1, Counted::instances);
+        element.value = 5;
+        EXPECT_TRUE(queue.tryPush(element));
+        EXPECT_TRUE(queue.tryPush(element));
+        EXPECT_EQ(3, Counted::instances);
+        Counted result;
+        EXPECT_TRUE(queue.tryPop(result));
+        EXPECT_EQ(5, result.value);
+        EXPECT_EQ(3, Counted::instances);
+    }
+    // Destruction of the queue destroys the remaining element
+    EXPECT_EQ(1, Counted::instances);
+}
+
+TEST_F(TestMpmcQueue, pushActivatesTask)
+{
+    EXPECT_TRUE(channel.tryPush(3));
+    EXPECT_TRUE(channel.tryPush(4));
+    scheduler.schedule();
+    EXPECT_EQ(7, task.sum);
+    EXPECT_LE(1u, task.executions);
+    EXPECT_TRUE(channel.isEmpty());
+}
+
+TEST_F(TestMpmcQueue, concurrentProducersAndConsumers)
+{
+    static const unsigned int numberOfThreads = 4u;
+    static const unsigned int elementsPerProducer = 10000u;
+    MpmcQueue<unsigned int, 64u> queue;
+    std::atomic<unsigned int> popped(0u);
+    std::atomic<unsigned long> sum(0u);
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0u; i < numberOfThreads; ++i)
+    {
+        threads.emplace_back([&queue]() {
+            for (unsigned int value = 1u; value <= elementsPerProducer; ++value)
+            {
+                while (!queue.tryPush(value))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&queue, &popped, &sum]() {
+            while (popped.load() < numberOfThreads * elementsPerProducer)
+            {
+                unsigned int value;
+                if (queue.tryPop(value))
+                {
+                    sum += value;
+                    popped++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(numberOfThreads * elementsPerProducer, popped.load());
+    EXPECT_EQ(static_cast<unsigned long>(numberOfThreads) * elementsPerProducer * (elementsPerProducer + 1u) / 2u,
+              sum.load());
+    EXPECT_TRUE(queue.isEmpty());
+}
@@ -0,0 +1,154 @@
+/*
+ * testSpscRing.cpp
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+#include <channels/spscRing.h>
+#include <task.h>
+#include <schedulerUnitTest.h>
+#include <schedulePolicyLifo.h>
+
+using Tasking::SpscRing;
+
+class TestSpscRing : public ::testing::Test
+{
+public:
+    class TestTask : public Tasking::TaskProvider<1, Tasking::SchedulePolicyLifo>
+    {
+    public:
+        /// Configure task with 1 input with one necessary push on related channel and not final
+        TestTask(Tasking::Scheduler& p_scheduler) :
+            TaskProvider<1, Tasking::SchedulePolicyLifo>(p_scheduler), executions(0u), sum(0)
+        {
+            inputs[0].configure(1, false);
+        }
+        void
+        execute(void) override
+        {
+            executions++;
+            int value;
+            while (getChannel<SpscRing<int, 4u>>(0u)->pop(value))
+            {
+                sum += value;
+            }
+        }
+        unsigned int executions;
+        int sum;
+    };
+
+    TestSpscRing(void) : scheduler(policy), task(scheduler)
+    {
+        task.configureInput(0, channel);
+        scheduler.start();
+    }
+
+protected:
+    Tasking::SchedulePolicyLifo policy;
+    Tasking::SchedulerUnitTest scheduler;
+    TestTask task;
+    SpscRing<int, 4u> channel;
+};
+
+TEST_F(TestSpscRing, construction)
+{
+    SpscRing<int, 2u> ringWithId(1726u);
+    EXPECT_EQ(1726u, ringWithId.getChannelId());
+    SpscRing<int, 2u> ringWithName("HoHo");
+    EXPECT_EQ(0x486F486Fu, ringWithName.getChannelId());
+    EXPECT_TRUE(ringWithName.isEmpty());
+}
+
+TEST_F(TestSpscRing, pushAndPopInOrder)
+{
+    SpscRing<int, 4u> ring;
+    int value = 0;
+    EXPECT_FALSE(ring.pop(value));
+    EXPECT_TRUE(ring.push(1));
+    EXPECT_TRUE(ring.push(2));
+    EXPECT_EQ(2u, ring.getCount());
+    EXPECT_TRUE(ring.pop(value));
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(ring.pop(value));
+    EXPECT_EQ(2, value);
+    EXPECT_TRUE(ring.isEmpty());
+}
+
+TEST_F(TestSpscRing, fullRing)
+{
+    SpscRing<int, 4u> ring;
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ring.push(i));
+    }
+    EXPECT_FALSE(ring.push(4));
+    int value = 0;
+    EXPECT_TRUE(ring.pop(value));
+    EXPECT_EQ(0, value);
+    // Wrap around the end of the ring
+    EXPECT_TRUE(ring.push(4));
+    for (int i = 1; i < 5; ++i)
+    {
+        EXPECT_TRUE(ring.pop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(ring.pop(value));
+}
+
+TEST_F(TestSpscRing, pushActivatesTask)
+{
+    EXPECT_TRUE(channel.push(3));
+    EXPECT_TRUE(channel.push(4));
+    scheduler.schedule();
+    EXPECT_EQ(7, task.sum);
+    EXPECT_LE(1u, task.executions);
+    EXPECT_TRUE(channel.isEmpty());
+}
+
+TEST_F(TestSpscRing, concurrentProducerAndConsumer)
+{
+    static const unsigned int numberOfElements = 100000u;
+    SpscRing<unsigned int, 64u> ring;
+    std::thread producer([&ring]() {
+        for (unsigned int i = 0u; i < numberOfElements; ++i)
+        {
+            while (!ring.push(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+    bool inOrder = true;
+    for (unsigned int expected = 0u; expected < numberOfElements;)
+    {
+        unsigned int value;
+        if (ring.pop(value))
+        {
+            inOrder = inOrder && (value == expected);
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(inOrder);
+    EXPECT_TRUE(ring.isEmpty());
+}
@@ -0,0 +1,162 @@
+/*
+ * testTripleBuffer.cpp
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+#include <channels/tripleBuffer.h>
+#include <task.h>
+#include <schedulerUnitTest.h>
+#include <schedulePolicyLifo.h>
+
+using Tasking::TripleBuffer;
+
+class TestTripleBuffer : public ::testing::Test
+{
+public:
+    class TestTask : public Tasking::TaskProvider<1, Tasking::SchedulePolicyLifo>
+    {
+    public:
+        /// Configure task with 1 input with one necessary push on related channel and not final
+        TestTask(Tasking::Scheduler& p_scheduler) :
+            TaskProvider<1, Tasking::SchedulePolicyLifo>(p_scheduler), readValue(0)
+        {
+            inputs[0].configure(1, false);
+        }
+        void
+        execute(void) override
+        {
+            readValue = getChannel<TripleBuffer<int>>(0u)->read();
+        }
+        /// By the task read value.
+        int readValue;
+    };
+
+    /// Element which is only consistent when both values are equal
+    struct Pair
+    {
+        unsigned int first;
+        unsigned int second;
+    };
+
+    TestTripleBuffer(void) : scheduler(policy), task(scheduler)
+    {
+        task.configureInput(0, channel);
+        scheduler.start();
+    }
+
+protected:
+    Tasking::SchedulePolicyLifo policy;
+    Tasking::SchedulerUnitTest scheduler;
+    TestTask task;
+    TripleBuffer<int> channel;
+};
+
+TEST_F(TestTripleBuffer, construction)
+{
+    TripleBuffer<int> bufferWithId(1726u);
+    EXPECT_EQ(1726u, bufferWithId.getChannelId());
+    TripleBuffer<int> bufferWithName("HoHo");
+    EXPECT_EQ(0x486F486Fu, bufferWithName.getChannelId());
+    TripleBuffer<int> initializedBuffer(42, "Init");
+    EXPECT_EQ(42, initializedBuffer.read());
+    EXPECT_FALSE(initializedBuffer.isUpdated());
+}
+
+TEST_F(TestTripleBuffer, readLatestValue)
+{
+    TripleBuffer<int> buffer(0, 1u);
+    buffer.send(1);
+    EXPECT_TRUE(buffer.isUpdated());
+    EXPECT_EQ(1, buffer.read());
+    EXPECT_FALSE(buffer.isUpdated());
+    // Without new data the read delivers the same value
+    EXPECT_EQ(1, buffer.read());
+    buffer.send(2);
+    buffer.send(3);
+    buffer.send(4);
+    EXPECT_EQ(4, buffer.read());
+}
+
+TEST_F(TestTripleBuffer, readReferenceIsStableDuringSend)
+{
+    TripleBuffer<int> buffer(0, 1u);
+    buffer.send(1);
+    const int& front = buffer.read();
+    for (int i = 2; i < 10; ++i)
+    {
+        buffer.send(i);
+        EXPECT_EQ(1, front);
+    }
+    EXPECT_EQ(9, buffer.read());
+}
+
+TEST_F(TestTripleBuffer, sendBuffer)
+{
+    TripleBuffer<int> buffer(0, 1u);
+    int* back = buffer.getBuffer();
+    *back = 17;
+    buffer.send(back);
+    EXPECT_EQ(17, buffer.read());
+    EXPECT_FALSE(back == buffer.getBuffer());
+    int value = 18;
+    buffer.send(&value);
+    EXPECT_EQ(18, buffer.read());
+}
+
+TEST_F(TestTripleBuffer, sendActivatesTask)
+{
+    channel.send(5);
+    scheduler.schedule();
+    EXPECT_EQ(5, task.readValue);
+}
+
+TEST_F(TestTripleBuffer, concurrentWriterAndReader)
+{
+    static const unsigned int numberOfSends = 100000u;
+    Pair initial = {0u, 0u};
+    TripleBuffer<Pair> buffer(initial, 1u);
+    std::atomic<bool> done(false);
+    std::thread writer([&buffer, &done]() {
+        for (unsigned int i = 1u; i <= numberOfSends; ++i)
+        {
+            Pair* back = buffer.getBuffer();
+            back->first = i;
+            back->second = i;
+            buffer.send(back);
+        }
+        done = true;
+    });
+    bool consistent = true;
+    bool ordered = true;
+    unsigned int last = 0u;
+    while (!done.load())
+    {
+        const Pair& pair = buffer.read();
+        consistent = consistent && (pair.first == pair.second);
+        ordered = ordered && (pair.first >= last);
+        last = pair.first;
+        std::this_thread::yield();
+    }
+    writer.join();
+    EXPECT_TRUE(consistent);
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(numberOfSends, buffer.read().first);
+}
@@ -216,7 +216,7 @@ main(void)
     // Add Fibonaccy task now to the channel and group both tasks, so execution times are equal from now on
     fibonaccyTask.configureInput(0, fibonaccyNumbers);
     fibonaccyTask.configureInput(1, trigger);
-    trigger.setRelativeTiming(200u); // Limit computation to only every 200 ms
+    trigger.setRelativeTiming(Tasking::fromMilliseconds(200u)); // Limit computation to only every 200 ms
     group.join(printerTask); // The example works also without the group by the priorities and speed limitation.
     group.join(fibonaccyTask);
 
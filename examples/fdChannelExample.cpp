@@ -0,0 +1,124 @@
+/*
+ * fdChannelExample.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * In this example the keyboard input is read by a task which is activated by a reactor when the standard input is
+ * readable. In difference to the IO channel example no thread blocks on a read, the task reads only the available
+ * data without blocking. The example works only on the linux platform.
+ */
+
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+#include <fdChannel.h>
+#include <reactor.h>
+#include <schedulerProvider.h>
+#include <schedulePolicyFifo.h>
+#include <task.h>
+
+/// Flag to signal main the end of the input
+volatile bool finished = false;
+
+/// Read in the available data from the standard input and print out complete lines
+class ReadKeyboardInput : public Tasking::TaskProvider<1u, Tasking::SchedulePolicyFifo>
+{
+public:
+    ReadKeyboardInput(Tasking::Scheduler& scheduler);
+    virtual void execute(void);
+
+private:
+    /// Collected characters of the current line
+    std::string line;
+    /// Number of lines read
+    unsigned int lines;
+};
+
+ReadKeyboardInput::ReadKeyboardInput(Tasking::Scheduler& scheduler) : TaskProvider(scheduler), lines(0u)
+{
+    // Trigger when the standard input is readable
+    inputs[0u].configure(1u);
+}
+
+void
+ReadKeyboardInput::execute(void)
+{
+    Tasking::FdChannel* in = getChannel<Tasking::FdChannel>(0u);
+    // Read until no more data is available. The read does not block, because the descriptor is non-blocking.
+    char buffer[64];
+    ssize_t received = read(in->getFd(), buffer, sizeof(buffer));
+    while (received > 0)
+    {
+        for (ssize_t i = 0; i < received; ++i)
+        {
+            if (buffer[i] == '\n')
+            {
+                lines++;
+                std::cout << "Line " << lines << ": " << line << std::endl;
+                finished = finished || (line == "end");
+                line.clear();
+            }
+            else
+            {
+                line += buffer[i];
+            }
+        }
+        received = read(in->getFd(), buffer, sizeof(buffer));
+    }
+    // End of file or a hang up of the input terminates also the program
+    if ((received == 0) || in->isClosed())
+    {
+        finished = true;
+    }
+}
+
+// <<<<<<== instances ==>>>>>
+
+Tasking::SchedulerProvider<1u, Tasking::SchedulePolicyFifo> scheduler;
+Tasking::Reactor reactor;
+Tasking::FdChannel inChannel(reactor, STDIN_FILENO);
+ReadKeyboardInput readTask(scheduler);
+
+// <<<<<< == program code == >>>>>
+
+int
+main(void)
+{
+    std::cout << "Type in some lines. Each line is printed out by a task when it is complete." << std::endl;
+    std::cout << "Type in end as single word to stop the program." << std::endl;
+
+    // Tasks shall not block, so the standard input is switched to non-blocking mode
+    fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+
+    // Connect task to the channel and start watching the standard input
+    readTask.configureInput(0u, inChannel);
+    scheduler.start();
+    inChannel.arm();
+
+    // Main has nothing to do until the input ends
+    while (!finished)
+    {
+        usleep(100000);
+    }
+
+    // Stop Tasking scheduler
+    scheduler.terminate(true);
+
+    return 0;
+}
@@ -289,7 +289,7 @@ main(void)
     printerTask.configureInput(1, filteredDataChannel);
 
     // Set clock to 500ms and starts after 1s
-    event.setPeriodicTiming(500, 1000u);
+    event.setPeriodicTiming(Tasking::fromMilliseconds(500u), Tasking::fromMilliseconds(1000u));
 
     // Start the scheduler with a reset action, which is needed to start timer
     scheduler.start(true);
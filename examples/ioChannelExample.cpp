@@ -136,7 +136,7 @@ HandleKeyboardInput::execute(void)
     // ... and print out
     out.print(newLine);
     // Wait 5 secondes to start removing first word from output line
-    outTrigger.trigger(5000u);
+    outTrigger.trigger(Tasking::fromMilliseconds(5000u));
 }
 
 // --------------------------
@@ -180,7 +180,7 @@ ModifiyLastWrittenLine::execute(void)
         // Output the new line
         out.print(newLine);
         // Self trigger in three seconds to remove the next word from line
-        getChannel<Tasking::Event>(0u)->trigger(3000);
+        getChannel<Tasking::Event>(0u)->trigger(Tasking::fromMilliseconds(3000u));
     }
 }
 // <<<<<<== instances ==>>>>>
@@ -66,7 +66,7 @@ void
 PrinterTask::execute(void)
 {
     // Get the time from the clock of the scheduler This time start with 0 when the scheduler is started.
-    Tasking::Time msAfterStart = scheduler.getTime();
+    Tasking::Time msAfterStart = Tasking::toNanoseconds(scheduler.getTime()) / 1000000u;
     // Get the task identification of this task
     Tasking::TaskId myId = getTaskId();
     // The task id was calculated from the given task name, truncated to four characters, but it can read out as text
@@ -141,11 +141,11 @@ main(void)
     scheduler.setZeroTime(0);
     if (periodicTrigger)
     {
-        trigger.setPeriodicTiming(time_ms, 1000u);
+        trigger.setPeriodicTiming(Tasking::fromMilliseconds(time_ms), Tasking::fromMilliseconds(1000u));
     }
     else
     {
-        trigger.setRelativeTiming(time_ms);
+        trigger.setRelativeTiming(Tasking::fromMilliseconds(time_ms));
     }
 
     // Start the scheduler with a reset action, which is needed to start relative timer
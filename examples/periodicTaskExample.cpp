@@ -63,7 +63,7 @@ void
 PeriodicTask::execute(void)
 {
     // Get the time from the clock of the scheduler This time start with 0 when the scheduler is started.
-    Tasking::Time msAfterStart = scheduler.getTime();
+    Tasking::Time msAfterStart = Tasking::toNanoseconds(scheduler.getTime()) / 1000000u;
     // Get the task identification of this task
     Tasking::TaskId myId = getTaskId();
     // The task id was calculated from the given task name, truncated to four characters, but it can read out as text
@@ -101,11 +101,11 @@ main(void)
     std::cin >> keyBoardinput;
     if (keyBoardinput[0] == 'r')
     {
-        trigger.setRelativeTiming(1000u);
+        trigger.setRelativeTiming(Tasking::fromMilliseconds(1000u));
     }
     else
     {
-        trigger.setPeriodicTiming(500, 1000u);
+        trigger.setPeriodicTiming(Tasking::fromMilliseconds(500u), Tasking::fromMilliseconds(1000u));
     }
 
     // Start the scheduler with a reset action, which is needed to start relative timer
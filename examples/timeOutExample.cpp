@@ -139,8 +139,8 @@ HandleKeyboardInput::execute(void)
                 out.getLastWrittenLine() + std::string(" ") + getChannel<KeyboardInputChannel>(0u)->getString();
         // ... and print out
         out.print(newLine);
-        // Wait 5 secondes to start removing first word from output line
-        outTrigger.trigger(5000u);
+        // Wait 5 secondes to start removing first word from output line. A running time out is only postponed.
+        outTrigger.restart(Tasking::fromMilliseconds(5000u));
     }
     else
     { // Time out was the reason for triggering the task when input zero is not activated
@@ -162,7 +162,7 @@ HandleKeyboardInput::execute(void)
             // Output the new line
             out.print(newLine);
             // Self trigger in three seconds to remove the next word from line
-            getChannel<Tasking::Event>(1u)->trigger(3000);
+            getChannel<Tasking::Event>(1u)->trigger(Tasking::fromMilliseconds(3000u));
         }
     }
 }
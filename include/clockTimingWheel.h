@@ -0,0 +1,61 @@
+/*
+ * clockTimingWheel.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_INCLUDE_CLOCKTIMINGWHEEL_H_
+#define TASKING_INCLUDE_CLOCKTIMINGWHEEL_H_
+
+#include "impl/clockTimingWheel_impl.h"
+
+namespace Tasking
+{
+
+class Scheduler;
+
+/**
+ * By default the clock of a scheduler keeps its events in a sorted list. Start and stop of an event search the list
+ * and are O(n) in the number of started events. A timing wheel replaces the list by a hierarchical timing wheel with
+ * O(1) start and stop of events. It pays off when many events are started at the same time, e.g. one time out event
+ * for each pending request.
+ *
+ * The wheel is used by the clock of the scheduler as long as the instance exists. Events already started are taken
+ * over at construction and handed back to the list at destruction. The slots of the wheel take about 11 kB of
+ * memory on a 64 bit system.
+ */
+class ClockTimingWheel
+{
+public:
+    /**
+     * Connect the timing wheel to the clock of a scheduler.
+     * @param scheduler Reference to the scheduler which clock uses the wheel as clock queue.
+     */
+    explicit ClockTimingWheel(Scheduler& scheduler);
+
+    /// Disconnect the timing wheel from the clock. Started events are moved back to the list of the clock.
+    ~ClockTimingWheel(void);
+
+private:
+    /// Forbid copy constructor
+    ClockTimingWheel(ClockTimingWheel&);
+
+    /// Implementation of the wheel
+    ClockTimingWheelImpl impl;
+};
+
+} // namespace Tasking
+
+#endif /* TASKING_INCLUDE_CLOCKTIMINGWHEEL_H_ */
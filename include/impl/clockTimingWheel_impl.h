@@ -0,0 +1,173 @@
+/*
+ * clockTimingWheel_impl.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_INCLUDE_IMPL_CLOCKTIMINGWHEEL_IMPL_H_
+#define TASKING_INCLUDE_IMPL_CLOCKTIMINGWHEEL_IMPL_H_
+
+#include "../taskTypes.h"
+
+namespace Tasking
+{
+
+// Forward declarations
+struct EventImpl;
+class Clock;
+
+/**
+ * Hierarchical timing wheel as clock queue. Each level has 64 slots, a slot of level n covers 64^n time units. An
+ * event is placed into the level of the highest digit in which its activation time differs from the wheel cursor. So
+ * insert and remove of an event are O(1). When the cursor reaches a slot of a higher level, the events of the slot
+ * are placed again into the lower levels. Each event is cascaded at most once per level.
+ *
+ * Events with an activation time before the cursor are kept in the due list in the order they expired. All methods
+ * are called by the clock inside the critical section of the clock queue.
+ *
+ * @see ClockTimingWheel
+ */
+struct ClockTimingWheelImpl
+{
+    /// Number of bits of the activation time which select the slot in a level.
+    static const unsigned int slotBits = 6u;
+
+    /// Number of slots in each level.
+    static const unsigned int slotsPerLevel = 1u << slotBits;
+
+    /// Number of levels to cover the whole range of time.
+    static const unsigned int levels = (64u + slotBits - 1u) / slotBits;
+
+    /// Index of the due list in the slot arrays.
+    static const unsigned int dueSlot = levels * slotsPerLevel;
+
+    /// Slot value of an event which is not queued in the wheel.
+    static const unsigned int noSlot = ~0u;
+
+    /**
+     * Initialize an empty wheel.
+     * @param clock Reference to the clock which uses the wheel as clock queue.
+     */
+    explicit ClockTimingWheelImpl(Clock& clock);
+
+    /**
+     * Insert an event by its activation time.
+     * @param currentTime Current time of the clock.
+     * @param event Reference to the event to insert.
+     * @return True when the event is the first event in the wheel with an activation time after the current time.
+     * If it is not known, true is returned and a superfluous timer start will happen.
+     */
+    bool insert(Time currentTime, EventImpl& event);
+
+    /**
+     * Put an event at the head of the due list. The activation time is not evaluated.
+     * @param event Reference to the event to insert.
+     */
+    void insertHead(EventImpl& event);
+
+    /**
+     * Remove an event from the wheel. If the event is not queued in the wheel, nothing happens.
+     * @param event Reference to the event to remove.
+     */
+    void remove(EventImpl& event);
+
+    /**
+     * Remove all events from the wheel.
+     * @param events Optional pointer to an empty list head. If given, all removed events are chained by their next
+     * pointer into the list and the queued flag of the events is kept.
+     */
+    void removeAll(EventImpl** events = nullptr);
+
+    /**
+     * Read and remove the first pending event.
+     * @param currentTime Current time of the clock.
+     * @return Pointer to the head of the due list if it is pending or nullptr.
+     */
+    EventImpl* readFirstPending(Time currentTime);
+
+    /**
+     * @param currentTime Current time of the clock.
+     * @return True when the head of the due list has an activation time equal or before the current time.
+     */
+    bool isPending(Time currentTime);
+
+    /**
+     * @param currentTime Current time of the clock.
+     * @return Earliest activation time after the current time or 0 if no event is in the future.
+     */
+    Time getNextStartTime(Time currentTime);
+
+    /// @return Activation time of the first event in the due list or the earliest in the wheel, 0 if empty.
+    Time getHeadTime(void) const;
+
+    /// @return True when no event is in the wheel.
+    bool isEmpty(void) const;
+
+    /**
+     * Move the cursor to one time unit after the current time. All events with an activation time up to the current
+     * time are moved to the due list.
+     * @param currentTime Current time of the clock.
+     */
+    void advance(Time currentTime);
+
+    /// Place an event relative to the cursor into a slot or the due list.
+    void place(EventImpl& event);
+
+    /// Append an event at the tail of a slot.
+    void append(unsigned int slot, EventImpl& event);
+
+    /// Unlink an event from its slot.
+    void unlink(EventImpl& event);
+
+    /// Place all events of a slot again relative to the cursor.
+    void cascade(unsigned int level, unsigned int digit);
+
+    /// Move all events of a slot of the lowest level to the tail of the due list.
+    void expire(unsigned int digit);
+
+    /// @return Earliest activation time of all events in the slots, 0 if there is none.
+    Time earliest(void) const;
+
+    /**
+     * @param bits A non-zero bit set.
+     * @return Position of the lowest set bit.
+     */
+    static unsigned int lowestBit(uint64_t bits);
+
+    /// Reference to the clock which uses the wheel.
+    Clock& clock;
+
+    /// First event of each slot and of the due list.
+    EventImpl* heads[dueSlot + 1u];
+
+    /// Last event of each slot and of the due list.
+    EventImpl* tails[dueSlot + 1u];
+
+    /// One bit for each non-empty slot of a level.
+    uint64_t occupied[levels];
+
+    /// Time of the wheel. All events with an activation time before the cursor are in the due list.
+    Time cursor;
+
+    /// Cached result of getNextStartTime. Only valid when nextStartValid is true.
+    Time nextStart;
+
+    /// Flag to mark the cached next start time as valid.
+    bool nextStartValid;
+};
+
+} // namespace Tasking
+
+#endif /* TASKING_INCLUDE_IMPL_CLOCKTIMINGWHEEL_IMPL_H_ */
@@ -26,6 +26,7 @@ namespace Tasking
 {
 
 class Scheduler;
+struct ClockTimingWheelImpl;
 
 /**
  * Base class to manage the start of events at a time point. It must be overloaded with a system specific clock
@@ -34,6 +35,15 @@ class Scheduler;
 class Clock
 {
 public:
+    /// Counters of the clock to rate the coalescing of events by their slack
+    struct Statistic
+    {
+        /// Number of wake ups which handled at least one pending event
+        unsigned int wakeUps;
+        /// Number of fired events
+        unsigned int firedEvents;
+    };
+
     /**
      * Initialization of the clock and connect it to scheduler
      *
@@ -49,8 +59,8 @@ public:
      * The method must be implemented by the bare metal implementation of the clock. Application programmer
      * can use this time for time stamps or to calculate the offset time of a periodic event.
      *
-     * @result Time which is in the time frame used for triggering events in ms. Most of the time zero time is start
-     * of the system.
+     * @result Time which is in the time frame used for triggering events in time ticks. Most of the time zero time is
+     * start of the system.
      *
      * @see Event::setPeriodicTiming
      */
@@ -62,11 +72,20 @@ public:
     /// @return True when activation time of the clock queue head element is equal or smaller than the current time.
     bool isPending(void) const;
 
+    /**
+     * Check for pending events like isPending and pass the time of the check to the caller, so the pending events can
+     * be handled without a further request of the time. The time is only requested when the queue is not empty.
+     *
+     * @param currentTime [out] Current time as returned by getTime(), only set when the queue is not empty.
+     * @return True when activation time of the clock queue head element is equal or smaller than the current time.
+     */
+    bool isPending(Time& currentTime) const;
+
     /**
      * Start an event at an absolute time.
      *
      * @param p_event Reference to the event to start at an absolute time
-     * @param time Absolute time in ms when the event should started. Time zero depends on the bare metal
+     * @param time Absolute time in time ticks when the event should started. Time zero depends on the bare metal
      * implementation. By default it should be the instantiation time of this class.
      */
     void startAt(EventImpl& p_event, const Time time);
@@ -75,10 +94,23 @@ public:
      * Start an event at a relative time span from now.
      *
      * @param p_event Reference to the event to start at the relative time
-     * @param time Relative time span from now in ms in which the event should started.
+     * @param time Relative time span from now in time ticks in which the event should started.
      */
     void startIn(EventImpl& p_event, const Time time);
 
+    /**
+     * Start all periodic and postponed events of a batch at their next activation time with one access to the clock
+     * queue. The next activation time of the events must be set before and the events should be protected by their
+     * mutex. The current time is taken before by the caller, so the handling of a batch needs only one request of the
+     * time. An event which gets due between the given time and now is queued as future event and gets pending by the
+     * next check of the clock queue.
+     *
+     * @param events First event of the batch, the following events are linked by nextPending.
+     * @param currentTime Current time as returned by getTime() when the batch was taken.
+     * @see takeAllPending
+     */
+    void startAllAt(EventImpl* events, Time currentTime);
+
     /**
      *  Enqueue an element to the clock queue. The method search the right position in the queue by the time,
      *  earliest time first. The last enqueued event is triggered first.
@@ -91,6 +123,19 @@ public:
      */
     bool enqueue(Time currentTime, EventImpl& event);
 
+    /**
+     * Place an event at an absolute time in the clock queue. Events in the past are placed at the head of the queue.
+     * Only called inside the protected area of the timeQueueMutex.
+     *
+     * @param event Reference to the event to place
+     * @param time Absolute activation time of the event
+     * @param currentTime Current timestamp as returned by getTime()
+     * @param shouldSignal [out] Set to true when the event is pending and the scheduler shall be signaled.
+     * @param shouldStartTimer [out] Set to true when the event is the first future event or brings the wake up within
+     * the slack of earlier events forward, and the timer shall start.
+     */
+    void place(EventImpl& event, Time time, Time currentTime, bool& shouldSignal, bool& shouldStartTimer);
+
     /**
      * Replace directly the head of the clock queue without searching the correct spot. This is done with events
      * which has a delay time with zero or smaller.
@@ -130,8 +175,23 @@ public:
     EventImpl* readFirstPending(void);
 
     /**
-     *  @return The time of the first event in the queue with start time in the future.
-     *  @see nonPendingHead
+     * Remove all pending events from the clock queue with one access to the clock queue.
+     *
+     * @param currentTime Current time as returned by getTime(). All events with an activation time up to this time
+     * are removed.
+     * @return First of the removed events in the order of the clock queue, or nullptr if no event is pending. The
+     * following events are linked by nextPending.
+     */
+    EventImpl* takeAllPending(Time currentTime);
+
+    /**
+     * The time of the next wake up of the clock. The wake up is delayed within the slack of the first future event
+     * in the queue, so long the window of activation time and slack overlaps with the windows of following events.
+     * Without slack it is the time of the first event in the queue with start time in the future.
+     *
+     * @return The time of the next wake up for events in the future, or 0 when there is no event in the future.
+     * @see nonPendingHead
+     * @see Event::setSlack
      */
     Time getNextStartTime(void);
 
@@ -140,6 +200,24 @@ public:
      */
     Time getHeadTime(void) const;
 
+    /// Count one wake up of the clock which handles pending events.
+    void reportWakeUp(void);
+
+    /**
+     * Read out the counters of the clock. Read out sets the counters back to zero.
+     * @param statistic [out] Reference to the structure to fill in with the current counters.
+     */
+    void readStatistic(Statistic& statistic);
+
+    /**
+     * Replace the clock queue by a timing wheel or return to the sorted list. Events in the current queue are moved
+     * to the new one.
+     *
+     * @param wheel Pointer to the timing wheel to use or nullptr to use the sorted list.
+     * @see ClockTimingWheel
+     */
+    void useTimingWheel(ClockTimingWheelImpl* wheel);
+
     /// Reference to the scheduler, which execute events from this clock implementation.
     Scheduler& scheduler;
 
@@ -163,6 +241,19 @@ public:
      * @see getNextStartTime
      */
     EventImpl* nonePendingHead;
+
+    /// Timing wheel which replaces the sorted list as clock queue, or nullptr if the list is used.
+    ClockTimingWheelImpl* timingWheel;
+
+    /// Counters of wake ups and fired events
+    Statistic statistic;
+
+    /**
+     * Wake up time returned by the last call of getNextStartTime, or 0 when there was no event in the future. A
+     * new event with an end of its slack before this time brings the wake up forward.
+     * @see place
+     */
+    Time nextWakeUpTime;
 };
 
 } // namespace Tasking
@@ -62,10 +62,19 @@ struct SchedulerImpl
 
     /**
      * Iterate over all pending events and execute them until no further event is pending. The method
-     * should call by the scheduler implementation frequently.
+     * should call by the scheduler implementation frequently. Pending events are taken in batches from the clock and
+     * periodic events of a batch are started again with one access to the clock queue.
      */
     void handleEvents(void);
 
+    /**
+     * Handle all pending events like handleEvents, but take the first batch with a time requested before by the
+     * caller, e.g. for the check of pending events.
+     *
+     * @param currentTime Current time as returned by the clock.
+     */
+    void handleEvents(Time currentTime);
+
     /**
      * Method which is called by the scheduler implementation to execute a task. The method embed the task
      * execution inside the synchronization call and finalize the task execution.
@@ -98,6 +107,13 @@ struct SchedulerImpl
      * @see execute
      */
     mutable Mutex synchronizationMutex;
+
+    /**
+     * Mutex to handle events only by one executor at a time. The batch of pending events is linked by the events
+     * itself, so a concurrent batch must not take an event again before the batch is handled.
+     * @see handleEvents
+     */
+    Mutex handleEventsMutex;
 };
 
 } // namespace Tasking
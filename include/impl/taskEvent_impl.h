@@ -67,6 +67,27 @@ struct EventImpl
     /// Next activation time.
     Time nextActivation_ms;
 
+    /// Tolerance after the activation time in which the clock may fire the event to join it with other events.
+    Time slack_ms;
+
+    /**
+     * Activation time to which a queued event is postponed, or zero if it is not postponed. The queue entry is not
+     * moved, when the entry is due the event is queued again for this time instead to fire.
+     */
+    Time postponedActivation_ms;
+
+    /// True when the event of a handled batch is queued again for its postponed activation instead to fire.
+    bool postponed;
+
+    /// Behavior of the periodic event when the activation of the next period is in the past
+    OverrunPolicy overrunPolicy;
+
+    /// Number of periods, or trigger steps of a periodic schedule, skipped by the overrun policy.
+    unsigned int skippedPeriods;
+
+    /// Number of periods coalesced into the last firing by the overrun policy coalesceOverrun.
+    unsigned int missedPeriods;
+
     /// Pointer to an schedule of periodic triggers to play
     PeriodicScheduleImpl* periodicSchedule;
 
@@ -82,6 +103,12 @@ struct EventImpl
      */
     EventImpl* previous;
 
+    /// Next event in a batch of pending events taken at once from the clock queue.
+    EventImpl* nextPending;
+
+    /// Slot of the timing wheel in which the event is queued, if the clock uses a timing wheel.
+    unsigned int wheelSlot;
+
     /// Area to protect access to event
     mutable Mutex mutex;
 
@@ -89,9 +116,32 @@ struct EventImpl
     volatile bool mutexLock;
 
     /**
-     * Task specific processing of the time event.
+     * Start the event in a time span from now. When the event is queued for an earlier time, the queue entry is kept
+     * and only the postponed activation is set, so the restart needs no search in the clock queue. Call it only inside
+     * the protected area of the event mutex.
+     *
+     * @param time Relative time span from now in time ticks in which the event should start.
+     */
+    void restartIn(const Time time);
+
+    /**
+     * Prepare the restart of a due event by the clock. A postponed event gets its postponed activation time and a
+     * periodic event the time of its next period. Call it only inside the protected area of the event mutex.
+     *
+     * @return True when the event shall be started again by the clock, because it is periodic or postponed.
      */
-    void handle(void);
+    bool prepareRestart(void);
+
+    /**
+     * Compute the next activation time of a periodic event. With a periodic schedule the pending triggers of the
+     * schedule are pushed. Periods in the past are skipped when the overrun policy is not catch up. Call it only
+     * inside the protected area of the event mutex.
+     * @return Next activation time to start the event by the clock.
+     */
+    Time stepToNextActivation(void);
+
+    /// Fire the event and push it to associated inputs when the event shall fire.
+    void fire(void);
 
     /**
      * Configure the event to an periodic timing
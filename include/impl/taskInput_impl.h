@@ -33,6 +33,62 @@ class Channel;
 class Task;
 struct TaskImpl;
 
+/**
+ * Notification state of an input. It holds all data which is accessed by a push of the associated channel. By default
+ * the state is part of the input, a channel with a fan-out copies the states of its inputs into a contiguous array.
+ *
+ * @see ChannelFanOut
+ */
+struct InputState
+{
+    /// Initialize an unconfigured state.
+    InputState(void);
+
+    /**
+     * Copy the notification data of another state. The mutex is not copied.
+     * @param other State to copy.
+     */
+    void assign(const InputState& other);
+
+    /// @result True if the notifications reach the activation threshold.
+    bool isActivated(void) const;
+
+    /**
+     * Count notifications of the channel and activate the task when the activation threshold is reached. In
+     * synchronous mode notifications above the threshold are counted as missed notifications.
+     *
+     * @param count Number of notifications, at least one.
+     */
+    void notify(unsigned int count);
+
+    /// Pointer to the task the channel is associated to.
+    TaskImpl* m_task;
+
+    /// Number of notifications since last reset
+    volatile unsigned int m_notifications;
+
+    /// Flag to count missed notifications in synchronization mode
+    volatile unsigned int m_missedNotifications;
+
+    /// Threshold of activation to activate the input
+    unsigned int m_activationThreshold;
+
+    /**
+     * Flag to indicate if the input is final. If true, an activation of the input will trigger
+     * the corresponding task immediately without respect to other inputs.
+     */
+    bool m_final;
+
+    /// Flag to indicate synchronization mode
+    bool m_synchron;
+
+    /// Mutex to synchronize asynchron calls in synchronization mode
+    Mutex m_mutex;
+
+    /// Flag to indicate the input as uninitialized
+    static const unsigned int uninitialized = std::numeric_limits<unsigned int>::max();
+};
+
 struct InputImpl
 {
 
@@ -55,41 +111,37 @@ struct InputImpl
      */
     void notifyInput(void);
 
-    /// Reference to the input implemented by the structure.
-    Input& parent;
-
-    /// Pointer to the task the channel is associated to.
-    TaskImpl* m_task;
-
-    /// The with the input associated channel.
-    Channel* m_channel;
+    /**
+     * Call to notify an input several times at once. The notifications are counted like single notifications and
+     * the associated task is activated at most once.
+     *
+     * @param count Number of notifications, at least one.
+     */
+    void notifyInput(unsigned int count);
 
     /**
-     * Flag to indicate if the input is final. If true, an activation of the input will trigger
-     * the corresponding task immediately without respect to other inputs.
+     * Move the notification state into the fan-out storage of the channel.
+     * @param frozenState State in the fan-out storage which becomes the state of the input.
      */
-    bool m_final;
+    void freeze(InputState& frozenState);
 
-    /// Flag to indicate synchronization mode
-    bool m_synchron;
+    /// Move the notification state back from the fan-out storage of the channel into the input.
+    void thaw(void);
 
-    /// Number of notifications since last reset
-    volatile unsigned int m_notifications;
+    /// Reference to the input implemented by the structure.
+    Input& parent;
 
-    /// Flag to count missed notifications in synchronization mode
-    volatile unsigned int m_missedNotifications;
+    /// The with the input associated channel.
+    Channel* m_channel;
 
-    /// Threshold of activation to activate the input
-    unsigned int m_activationThreshold;
+    /// Notification state of the input. It points to the own state or into the fan-out storage of the channel.
+    InputState* m_state;
 
-    /// Mutex to synchronize asynchron calls in synchronization mode
-    Mutex m_mutex;
+    /// Notification state of the input when the channel has no frozen fan-out
+    InputState m_ownState;
 
     /// Next input in the list of associated inputs of a channel
     InputImpl* channelNextInput;
-
-    /// Flag to indicate the input as uninitialized
-    static const unsigned int uninitialized = std::numeric_limits<unsigned int>::max();
 };
 
 } // namespace Tasking
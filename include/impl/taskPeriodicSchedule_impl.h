@@ -26,6 +26,19 @@ namespace Tasking
 
 class PeriodicScheduleTrigger;
 
+/**
+ * Entry of a compiled periodic schedule table. Consecutive entries with the same offset build one slot of the table
+ * and are played by one activation of the event.
+ */
+struct PeriodicScheduleTableEntry
+{
+    /// Offset time of the entry inside the hyperperiod
+    Tasking::Time offset;
+
+    /// Trigger to push at the offset time
+    PeriodicScheduleTrigger* trigger;
+};
+
 /**
  * Implementation structure of an periodic schedule. This structure hold all data and
  * internal functions to process an periodic schedule.
@@ -43,6 +56,23 @@ struct PeriodicScheduleImpl
      */
     void sortIn(PeriodicScheduleTrigger& trigger);
 
+    /**
+     * Merge the triggers of a schedule with the given period into the table. The table is expanded to the least
+     * common multiple of its hyperperiod and the period before the triggers of all periods are sorted in.
+     *
+     * @param period Period of the schedule to merge.
+     * @param schedule Schedule with the sorted list of triggers. Triggers outside of the period are ignored.
+     * @result True if the schedule is merged, false if the table is too small, the period is zero or the hyperperiod
+     * would overflow. In this case the table is unchanged.
+     */
+    bool compileIn(Tasking::Time period, const PeriodicScheduleImpl& schedule);
+
+    /// @result True if the schedule has no trigger to play.
+    bool isEmpty(void) const;
+
+    /// Restart the play of the schedule with the first trigger of the next period.
+    void rewind(void);
+
     /**
      * Loop over the next periodic triggers with the same offset and push them. As side effect active trigger move on.
      */
@@ -66,6 +96,21 @@ struct PeriodicScheduleImpl
 
     /// Period of schedule
     Tasking::Time period_ms;
+
+    /// Entries of a compiled table sorted by offset, or null pointer when the list of triggers is played.
+    PeriodicScheduleTableEntry* table;
+
+    /// Number of entries the table can store
+    unsigned int tableCapacity;
+
+    /// Number of used entries in the table
+    unsigned int tableSize;
+
+    /// Index of the last activated entry in the table. The value tableSize marks a not started table.
+    unsigned int activeEntry;
+
+    /// Least common multiple of all periods merged into the table.
+    Tasking::Time hyperperiod_ms;
 };
 
 } // namespace Tasking
@@ -131,6 +131,18 @@ struct TaskImpl
 
     /// Pointer to the group in which the task is joined.
     GroupImpl* group;
+
+    /// Task which is executed directly after this task in the same executor slot, null if the task is not fused.
+    TaskImpl* fusedSuccessor;
+
+    /// Task after which this task is executed in the same executor slot, null if the task is not fused.
+    TaskImpl* fusedPredecessor;
+
+    /// True while the task is executed and has a fused successor. Protected by taskMutex.
+    bool executing;
+
+    /// True if an activation was deferred until the fused predecessor ends. Protected by taskMutex of predecessor.
+    bool fusedPending;
 };
 
 } // namespace Tasking
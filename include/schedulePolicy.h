@@ -73,6 +73,18 @@ public:
      * is returned.
      */
     virtual Tasking::TaskImpl* nextTask(void) = 0;
+
+    /**
+     * Request and remove the next task for a specific executor of the scheduler. Policies which distribute tasks to
+     * executors can override this method. By default the next task in the scheduling order is delivered.
+     * @param executorIndex Index of the requesting executor in the scheduler.
+     * @return Pointer to the next task for the executor. If no pending task is available, nullptr is returned.
+     */
+    virtual Tasking::TaskImpl*
+    nextTaskFor(unsigned int /* executorIndex */)
+    {
+        return nextTask();
+    }
 };
 
 } // namespace Tasking
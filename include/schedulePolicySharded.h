@@ -0,0 +1,268 @@
+/*
+ * schedulePolicySharded.h
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASKING_INCLUDE_SCHEDULEPOLICYSHARDED_H_
+#define TASKING_INCLUDE_SCHEDULEPOLICYSHARDED_H_
+
+#include <type_traits>
+
+#include "schedulePolicy.h"
+#include "impl/task_Impl.h"
+
+namespace Tasking
+{
+
+/**
+ * A scheduling policy which partitions the tasks of one scheduler to several inner scheduling policies, the shards.
+ * Each shard has its own run queue and lock, so independent subsystems performed by the same scheduler do not contend
+ * on one queue. The shard of a task is selected by a shard function at each queue operation.
+ *
+ * Executors of the scheduler ask with nextTaskFor for a task. An executor prefers its home shard, which is the shard
+ * with the executor index modulo the number of shards, and scans the other shards when the home shard is empty.
+ *
+ * It is recommended to use the template class SchedulePolicyShardedProvider to set up the policy.
+ * @see SchedulePolicyShardedProvider
+ */
+class SchedulePolicySharded : public SchedulePolicy
+{
+public:
+    /// Number of a shard
+    typedef unsigned int Shard;
+
+    /**
+     * Function to select the shard of a task. The result is taken modulo the number of shards.
+     * @param task Reference to the task which is queued.
+     * @result Shard of the task.
+     */
+    typedef Shard (*ShardFunction)(const TaskImpl& task);
+
+    /**
+     * Shard function to select the shard by the group of a task. All tasks of a group are in the same shard. Tasks
+     * which are not joined to a group are sharded by the task identification.
+     */
+    static Shard shardByGroup(const TaskImpl& task);
+
+    /// Shard function to select the shard by the identification of a task.
+    static Shard shardByTaskId(const TaskImpl& task);
+
+    /**
+     * Initialize the sharded policy.
+     * @param shards Pointer to an array of pointers to the inner policies. All inner policies must use the same
+     * management data for tasks.
+     * @param numberOfShards Number of inner policies in the array. It must not be zero.
+     * @param shardFunction Function to select the shard of a task.
+     */
+    SchedulePolicySharded(SchedulePolicy** shards, unsigned int numberOfShards,
+                          ShardFunction shardFunction = shardByGroup);
+
+    /**
+     * Queue the task to the inner policy of its shard.
+     * @param task Reference to the task to queue.
+     * @return True when the shard of the task was empty at call time.
+     */
+    bool queue(TaskImpl& task) override;
+
+    /**
+     * Request the next task. The shards are scanned in round robin order starting at the shard after the one of the
+     * last call.
+     * @return Pointer to the next task of the first non-empty shard or nullptr if all shards are empty.
+     */
+    TaskImpl* nextTask(void) override;
+
+    /**
+     * Request the next task for an executor. The home shard of the executor is asked first, then the others.
+     * @param executorIndex Index of the executor in the scheduler.
+     * @return Pointer to the next task or nullptr if all shards are empty.
+     */
+    TaskImpl* nextTaskFor(unsigned int executorIndex) override;
+
+protected:
+    /**
+     * Select the shard for a task. By default the shard function is called.
+     * @param task Reference to the task which is queued.
+     * @result Shard of the task, less than the number of shards.
+     */
+    virtual Shard selectShard(const TaskImpl& task) const;
+
+    /**
+     * Scan all shards for a task beginning with the start shard.
+     * @param start First shard to ask.
+     * @return Pointer to the next task or nullptr if all shards are empty.
+     */
+    TaskImpl* scan(Shard start);
+
+    /// Pointer to the array of inner policies.
+    SchedulePolicy** shards;
+
+    /// Number of inner policies
+    unsigned int numberOfShards;
+
+    /// Function to select a shard of a task
+    ShardFunction shardFunction;
+
+    /// Shard where the round robin scan of nextTask starts. Only a hint, so it is not protected.
+    volatile Shard nextShard;
+};
+
+/**
+ * Provider class to set up a sharded policy with inner policies of the same type. Tasks use the management data and
+ * settings of the provider, which extend the ones of the inner policy by an explicit shard.
+ *
+ * @tparam InnerPolicy Type of the inner policies. It must be default constructible, e.g. SchedulePolicyFifo or
+ * SchedulePolicyPSlotProvider.
+ * @tparam tp_numberOfShards Number of inner policies.
+ */
+template<class InnerPolicy, unsigned int tp_numberOfShards>
+class SchedulePolicyShardedProvider : public SchedulePolicySharded
+{
+public:
+    /// Value of an explicit shard to mark that the shard function of the policy is used.
+    static const Shard anyShard = ~0u;
+
+    /// Settings of a task, the settings of the inner policy with an explicit shard.
+    struct Settings
+    {
+        /**
+         * Initialize settings with the default settings of the inner policy.
+         * @param p_shard Explicit shard of the task or anyShard to use the shard function.
+         */
+        explicit Settings(Shard p_shard);
+
+        /**
+         * Initialize settings with settings of the inner policy.
+         * @param p_shard Explicit shard of the task or anyShard to use the shard function.
+         * @param p_inner Settings of the task for the inner policy.
+         */
+        Settings(Shard p_shard, typename InnerPolicy::Settings p_inner);
+
+        /// Explicit shard of the task.
+        Shard shard;
+
+        /// Settings for the inner policy.
+        typename InnerPolicy::Settings inner;
+    };
+
+    /// Management data of the inner policy with the explicit shard of the task.
+    struct ManagementData : public InnerPolicy::ManagementData
+    {
+        /// Initialize without explicit shard.
+        ManagementData(void);
+
+        /// Initialize with settings. Settings of the inner policy are only used if its management data needs them.
+        ManagementData(Settings settings);
+
+        /// Explicit shard of the task or anyShard.
+        Shard shard;
+
+    private:
+        /// Initialize inner management data with the settings of the inner policy.
+        ManagementData(Settings settings, std::true_type);
+
+        /// Initialize inner management data without settings.
+        ManagementData(Settings settings, std::false_type);
+    };
+
+    /**
+     * Initialize the inner policies.
+     * @param shardFunction Function to select the shard of a task without explicit shard.
+     */
+    explicit SchedulePolicyShardedProvider(ShardFunction shardFunction = shardByGroup);
+
+protected:
+    /// Select the explicit shard of a task or the result of the shard function if none is set.
+    Shard selectShard(const TaskImpl& task) const override;
+
+private:
+    /// The inner policies.
+    InnerPolicy policies[tp_numberOfShards];
+
+    /// Array with pointers to the inner policies.
+    SchedulePolicy* policyPointers[tp_numberOfShards];
+};
+
+// --- implementation of provider ----
+
+template<class InnerPolicy, unsigned int tp_numberOfShards>
+SchedulePolicyShardedProvider<InnerPolicy, tp_numberOfShards>::Settings::Settings(Shard p_shard) :
+    shard(p_shard), inner()
+{
+}
+
+template<class InnerPolicy, unsigned int tp_numberOfShards>
+SchedulePolicyShardedProvider<InnerPolicy, tp_numberOfShards>::Settings::Settings(Shard p_shard,
+                                                                               typename InnerPolicy::Settings p_inner) :
+    shard(p_shard), inner(p_inner)
+{
+}
+
+template<class InnerPolicy, unsigned int tp_numberOfShards>
+SchedulePolicyShardedProvider<InnerPolicy, tp_numberOfShards>::ManagementData::ManagementData(void) :
+    InnerPolicy::ManagementData(), shard(anyShard)
+{
+}
+
+template<class InnerPolicy, unsigned int tp_numberOfShards>
+SchedulePolicyShardedProvider<InnerPolicy, tp_numberOfShards>::ManagementData::ManagementData(Settings settings) :
+    ManagementData(settings, std::is_constructible<typename InnerPolicy::ManagementData,
+                                                   typename InnerPolicy::Settings>())
+{
+}
+
+template<class InnerPolicy, unsigned int tp_numberOfShards>
+SchedulePolicyShardedProvider<InnerPolicy, tp_numberOfShards>::ManagementData::ManagementData(Settings settings,
+                                                                                           std::true_type) :
+    InnerPolicy::ManagementData(settings.inner), shard(settings.shard)
+{
+}
+
+template<class InnerPolicy, unsigned int tp_numberOfShards>
+SchedulePolicyShardedProvider<InnerPolicy, tp_numberOfShards>::ManagementData::ManagementData(Settings settings,
+                                                                                           std::false_type) :
+    InnerPolicy::ManagementData(), shard(settings.shard)
+{
+}
+
+template<class InnerPolicy, unsigned int tp_numberOfShards>
+SchedulePolicyShardedProvider<InnerPolicy, tp_numberOfShards>::SchedulePolicyShardedProvider(
+        ShardFunction shardFunction) :
+    SchedulePolicySharded(policyPointers, tp_numberOfShards, shardFunction)
+{
+    static_assert(std::is_base_of<SchedulePolicy, InnerPolicy>::value,
+                  "InnerPolicy needs to be derived from Tasking::SchedulePolicy");
+    static_assert(tp_numberOfShards > 0u, "At least one shard is needed");
+    for (unsigned int i = 0u; i < tp_numberOfShards; ++i)
+    {
+        policyPointers[i] = policies + i;
+    }
+}
+
+template<class InnerPolicy, unsigned int tp_numberOfShards>
+typename SchedulePolicyShardedProvider<InnerPolicy, tp_numberOfShards>::Shard
+SchedulePolicyShardedProvider<InnerPolicy, tp_numberOfShards>::selectShard(const TaskImpl& task) const
+{
+    Shard shard = static_cast<const ManagementData*>(task.policyData)->shard;
+    if (shard == anyShard)
+    {
+        shard = SchedulePolicySharded::selectShard(task);
+    }
+    return shard % tp_numberOfShards;
+}
+
+} // namespace Tasking
+
+#endif /* TASKING_INCLUDE_SCHEDULEPOLICYSHARDED_H_ */
@@ -86,7 +86,10 @@ public:
 
     /**
      * Call initialize method of all associated tasks of the scheduler. A task is associated to a task when it
-     * is constructed with a reference to the scheduler instance.
+     * is constructed with a reference to the scheduler instance. Afterwards the channels connected to the tasks freeze
+     * their inputs when a fan-out storage is assigned to them.
+     *
+     * @see Channel::setFanOut
      */
     void initialize(void);
 
@@ -94,14 +97,23 @@ public:
      * Get the absolute time used to control events. The zero time depends on the bare metal implementation. Application
      * programmer can use this time for time stamps or to calculate the offset time of a periodic event.
      *
-     * @result Time which is in the time frame used for triggering events in ms. Most of the time, zero time is start
-     * of the system.
+     * @result Time which is in the time frame used for triggering events in time ticks. Most of the time, zero time is
+     * start of the system.
      *
      * @see Event::setPeriodicTiming
      * @see setZeroTime
      */
     Time getTime(void) const;
 
+    /**
+     * Read out the number of wake ups of the clock and the number of events fired by these wake ups. The ratio of
+     * both shows the reduction of wake ups by the slack of the events. Read out sets the counters back to zero.
+     *
+     * @param statistic [out] Reference to the structure to fill in with the counters of the clock.
+     * @see Event::setSlack
+     */
+    void readClockStatistic(Clock::Statistic& statistic);
+
 protected:
     /**
      * Pure abstract method which must be implemented by the bare metal implementation of the scheduler.
@@ -136,6 +148,12 @@ Tasking::Scheduler::getTime() const
     return impl.clock.getTime();
 }
 
+inline void
+Tasking::Scheduler::readClockStatistic(Clock::Statistic& statistic)
+{
+    impl.clock.readStatistic(statistic);
+}
+
 inline Tasking::SchedulerImpl&
 Tasking::Scheduler::getImpl(void)
 {
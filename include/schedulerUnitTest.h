@@ -41,7 +41,7 @@ public:
 
     /**
      * Execute all pending tasks.
-     * @param timeSpan Time step in milliseconds the clock is forwarded in one step. If in the time span more than one
+     * @param timeSpan Time step in time ticks the clock is forwarded in one step. If in the time span more than one
      * event is triggered, the unit test behaves not like an implemented system. Also an event with a higher frequency
      * than the time span will only trigger one time.
      */
@@ -73,12 +73,12 @@ protected:
          */
         ClockUnitTest(SchedulerUnitTest& scheduler);
 
-        /// @return Current simulated time in ms.
+        /// @return Current simulated time in time ticks.
         Time getTime(void) const override;
 
         /**
          * Step forward in the simulated time.
-         * @param span Time step in milliseconds the clock is forwarded.
+         * @param span Time step in time ticks the clock is forwarded.
          */
         void step(Tasking::Time span);
 
@@ -132,6 +132,24 @@ public:
     /// @result True if all inputs are configured and connected to a channel.
     bool isValid(void) const;
 
+    /**
+     * Fuse a successor task to this task. When the successor is activated while this task is executed, the successor
+     * is not queued at the scheduling policy. Instead it is executed directly after this task in the same executor
+     * slot. Synchronization of the channels between both tasks is done in one critical section and all tasks of a
+     * fused chain are reset together after the last one is executed. Each task of the chain is still executed,
+     * synchronized and reset by itself. A chain can be extended by fusing the successor again with a further task.
+     *
+     * Fusing is intended for linear pipelines where this task is the producer of the channel at the only input of
+     * the successor. Call the method before the scheduler is started.
+     *
+     * @param successor Reference to the task which follows this task. It must have exactly one input and must be
+     * performed by the same scheduler.
+     *
+     * @result True if the task was fused. False if the successor has more than one input, is performed by another
+     * scheduler, one of both tasks is already fused in this direction, or the fusion would close a cycle.
+     */
+    bool fuse(Task& successor);
+
     /**
      * A call resets the activation state of all task inputs. This method is called whenever a task was executed
      * by the associated scheduler or when the task belongs to a group all tasks of the group are executed.
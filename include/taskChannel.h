@@ -19,7 +19,9 @@
 #ifndef TASKCHANNEL_H_
 #define TASKCHANNEL_H_
 
+#include <stddef.h>
 #include "taskTypes.h"
+#include "taskInput.h"
 
 namespace Tasking
 {
@@ -28,6 +30,31 @@ namespace Tasking
 struct InputImpl;
 class Task;
 struct TaskingAccessor;
+class ChannelFanOut;
+class Channel;
+
+/**
+ * Interface to observe the data published by channels, e.g. to record the traffic of channels. A tap is assigned to
+ * a channel with Channel::setTap. It is called by the thread which pushes the channel, so an implementation shall be
+ * thread safe and fast.
+ *
+ * @see Channel::setTap
+ */
+class ChannelTap
+{
+public:
+    /// Destructor needed by virtual methods
+    virtual ~ChannelTap(void);
+
+    /**
+     * Called by a push of a tapped channel before the inputs are notified.
+     *
+     * @param channel The pushed channel.
+     * @param data Pointer to the published data. It is null when the channel has no data, e.g. a barrier.
+     * @param size Size of the published data in bytes.
+     */
+    virtual void tap(const Channel& channel, const void* data, size_t size) = 0;
+};
 
 /**
  * A task channel is the base for a data container to store data and distribute this data to
@@ -113,6 +140,26 @@ public:
      */
     void setChannelId(ChannelId newChannelId);
 
+    /**
+     * Assign a storage to freeze the associated inputs. Scheduler::initialize copies the notification states of all
+     * associated inputs into the contiguous storage, so a push walks over an array instead of a linked list of inputs
+     * spread over the tasks. A change of the associated inputs thaws the states until the next initialization.
+     * If the storage is too small, the channel keeps the inputs in the list.
+     *
+     * @param fanOut Storage for the notification states. It has to exist as long as the channel.
+     *
+     * @see ChannelFanOutProvider
+     */
+    void setFanOut(ChannelFanOut& fanOut);
+
+    /**
+     * Assign a tap which observes all pushes of the channel. Channels with data, like the FIFO or the buffers, pass
+     * their data to the tap, other channels only the push.
+     *
+     * @param tap Pointer to the tap or null to remove the tap.
+     */
+    void setTap(ChannelTap* tap);
+
 protected:
     /**
      * Establish an association to an input. This method is called when an input is configured.
@@ -143,6 +190,35 @@ protected:
      */
     void push(void);
 
+    /**
+     * Finalize a push operation with the published data. Like push, but the data is passed to the tap of the channel.
+     * A specialization as data container should use this method instead of push.
+     *
+     * @param data Pointer to the published data.
+     * @param size Size of the published data in bytes.
+     */
+    void pushData(const void* data, size_t size);
+
+    /**
+     * Pass published data to the tap of the channel without notification of the inputs. It is used for data which is
+     * notified by pushBatch.
+     *
+     * @param data Pointer to the published data.
+     * @param size Size of the published data in bytes.
+     */
+    void tap(const void* data, size_t size) const;
+
+    /**
+     * Finalize a push operation of several data elements at once. The associated inputs are notified in one pass as
+     * if push was called count times, but each input activates its task at most once.
+     *
+     * @param count Number of published data elements. With zero nothing happens.
+     *
+     * The elements are not passed to the tap of the channel, a specialization as data container calls tap for each
+     * element.
+     */
+    void pushBatch(unsigned int count);
+
     /**
      * A task which expects data from this channel is started. A specialization as data container can override
      * the method with own synchronization stuff. The call is synchronized by the associated scheduler of the started
@@ -178,11 +254,101 @@ protected:
      */
     virtual void reset(void);
 
+    /**
+     * Copy the notification states of all associated inputs into the fan-out storage. Nothing happens if the channel
+     * has no fan-out storage or the inputs are frozen already.
+     *
+     * @result True if the inputs are frozen.
+     */
+    bool freeze(void);
+
+    /// Move the notification states back into the inputs.
+    void thaw(void);
+
 private:
     /// Head of list of task inputs associated to this channel.
     InputImpl* m_inputs;
+
+    /// Storage of the frozen inputs, null if the channel notifies the inputs via the list.
+    ChannelFanOut* m_fanOut;
+
+    /// Tap which observes the pushes, null if the channel is not tapped.
+    ChannelTap* m_tap;
+};
+
+/**
+ * Storage for the frozen notification states of the inputs associated to a channel. The storage is provided by the
+ * class ChannelFanOutProvider.
+ *
+ * @see Channel::setFanOut
+ */
+class ChannelFanOut
+{
+    friend Channel;
+
+public:
+    /// @result Number of frozen inputs. Zero if the inputs of the channel are not frozen.
+    unsigned int getNumberOfInputs(void) const;
+
+protected:
+    /**
+     * Initialize an empty storage.
+     * @param states Storage of the notification states.
+     * @param numberOfStates Number of states in the storage.
+     */
+    ChannelFanOut(InputState* states, unsigned int numberOfStates);
+
+    /// Storage of the notification states
+    InputState* const states;
+
+    /// Number of states in the storage
+    const unsigned int capacity;
+
+    /// Number of frozen inputs
+    unsigned int size;
+};
+
+/**
+ * Provider of the storage for the frozen inputs of a channel.
+ *
+ * @tparam numberOfInputs Maximal number of inputs associated to the channel.
+ */
+template<unsigned int numberOfInputs>
+class ChannelFanOutProvider : public ChannelFanOut
+{
+public:
+    /// Initialize an empty storage.
+    ChannelFanOutProvider(void);
+
+protected:
+    /// Storage of the notification states
+    InputState inputStates[numberOfInputs];
 };
 
+// --- implementation of provider ----
+
+template<unsigned int numberOfInputs>
+ChannelFanOutProvider<numberOfInputs>::ChannelFanOutProvider(void) : ChannelFanOut(inputStates, numberOfInputs)
+{
+}
+
+// --- inlines ----
+
+inline void
+Channel::tap(const void* data, size_t size) const
+{
+    if (m_tap != nullptr)
+    {
+        m_tap->tap(*this, data, size);
+    }
+}
+
+inline unsigned int
+ChannelFanOut::getNumberOfInputs(void) const
+{
+    return size;
+}
+
 } // namespace Tasking
 
 #endif /* TASKCHANNEL_H_ */
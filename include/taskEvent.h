@@ -26,6 +26,7 @@ namespace Tasking
 
 // Forward definition of periodic schedule
 class PeriodicSchedule;
+class PeriodicScheduleTable;
 
 /**
  * The task event is a timed event. The behavior of the event can be periodically or relative to the
@@ -96,13 +97,28 @@ public:
      */
     void setPeriodicSchedule(const Time period, const Time offset, PeriodicSchedule& schedule);
 
+    /**
+     * Set the timing of event to play a compiled table of periodic schedules. The table is played with its
+     * hyperperiod as period and each slot of the table needs one activation of the event. Call this method only:
+     * from a constructor, when the scheduler is initializing, or when the timer is stopped.
+     *
+     * @param offset Offset of the start time of the system. If the offset is in the past, the method computes
+     * the next time point in the future by adding a multiple of the hyperperiod to the offset.
+     *
+     * @param table Reference to the compiled table of periodic schedules.
+     *
+     * @see setPeriodicSchedule
+     * @see PeriodicScheduleTable
+     */
+    void setPeriodicSchedule(const Time offset, PeriodicScheduleTable& table);
+
     /**
      * Set the timing of the event relative to the reset operation. A call to reset will trigger the task event
      * for the next activation. To start the relative timing a call to the reset operation is necessary. Keep in
      * mind that a reset restarts the timer, when the event is connected to several tasks or a final input is
      * connected to the task.
      *
-     * @param delay Delay time in milliseconds which is used as trigger time relative to the reset operation.
+     * @param delay Delay time in time ticks which is used as trigger time relative to the reset operation.
      */
     void setRelativeTiming(const Time delay);
 
@@ -113,7 +129,7 @@ public:
      * means reset operations on connected tasks will stop the event timer, e.g. when the event is connected to
      * several tasks or anconnected task with an input configured as final.
      *
-     * @param time Offset time in ms when the event is triggered out of order. This can use to trigger an
+     * @param time Offset time in time ticks when the event is triggered out of order. This can use to trigger an
      * task after a specified time to another task.
      *
      * @see setPeriodicTiming
@@ -121,6 +137,50 @@ public:
      */
     void trigger(Time time = 0);
 
+    /**
+     * Trigger the event like trigger with a time span, but optimized for time outs which are restarted more often
+     * than they expire, e.g. a watchdog restarted by each message. When the event is queued by the clock for an
+     * earlier time, the queue entry is kept and only the activation is postponed to the new time. When the old entry
+     * is due, the event is queued again for the postponed time instead to fire. So a restart needs no search in
+     * the clock queue. A restart to an earlier time is done like trigger.
+     *
+     * @param time Time span in time ticks from now when the event is triggered.
+     *
+     * @see trigger
+     */
+    void restart(Time time);
+
+    /**
+     * Set the tolerance of the activation time. The clock may fire the event up to the slack after its activation
+     * time, but never before. Events with overlapping windows of activation time and slack are fired by one wake up
+     * of the clock, which reduces the number of wake ups for many events with slightly different times. The slack is
+     * not used when the clock queue is a timing wheel.
+     *
+     * @param slack Tolerance in time ticks after the activation time. By default the slack is zero.
+     */
+    void setSlack(const Time slack);
+
+    /**
+     * Set the behavior of a periodic event, when it is handled so late that the activation of the next period is
+     * already in the past. By default the event catches up and fires once for each missed period immediately. With
+     * skipOverrun the missed periods, including a period due at the late handling, are skipped and the event continues
+     * with the next period in the future.
+     * With coalesceOverrun the missed periods are skipped too, but the late firing reports them by getMissedPeriods.
+     * With a periodic schedule the skipped trigger steps are not pushed.
+     *
+     * @param policy The overrun policy of the event.
+     */
+    void setOverrunPolicy(OverrunPolicy policy);
+
+    /// @return Number of periods, or trigger steps of a periodic schedule, which are skipped by the overrun policy.
+    unsigned int getSkippedPeriods(void) const;
+
+    /**
+     * @return Number of missed periods coalesced into the last firing with the overrun policy coalesceOverrun. Read
+     * it in onFire or by the connected task.
+     */
+    unsigned int getMissedPeriods(void) const;
+
     /// @return True, when the clock is still queued for triggering at the clock.
     bool isTriggered(void) const;
 
@@ -27,6 +27,7 @@ namespace Tasking
 
 struct EventImpl;
 // Forward definition of the event
+class Event;
 
 /**
  * Class to define a time trigger in the periodic schedule. This class acts as a channel and will be connected to
@@ -68,6 +69,7 @@ private:
 class PeriodicSchedule
 {
     friend EventImpl;
+    friend class PeriodicScheduleTable;
 
 public:
     /**
@@ -82,6 +84,77 @@ private:
     PeriodicScheduleImpl impl;
 };
 
+/**
+ * A periodic schedule table is the compiled form of one or several periodic schedules with possibly different
+ * periods. The triggers of all schedules are flattened into a contiguous table over the hyperperiod, the least common
+ * multiple of all periods. Triggers with the same offset in the hyperperiod build one slot of the table. An event
+ * playing the table needs only one clock entry per slot, instead of one entry per trigger step and schedule.
+ *
+ * The table is compiled by adding the schedules with their periods. Later changes of the added schedules have no
+ * effect on the table. The storage of the table is provided by the class PeriodicScheduleTableProvider.
+ *
+ * @see PeriodicScheduleTableProvider
+ * @see Event::setPeriodicSchedule
+ */
+class PeriodicScheduleTable
+{
+    friend Event;
+
+public:
+    /**
+     * Compile the triggers of a schedule into the table. Call this method only when the table is not played by an
+     * event.
+     *
+     * @param period Period of the schedule. Triggers with an offset outside of the period are ignored.
+     * @param schedule Schedule with the triggers to compile in.
+     * @result True if the schedule is compiled in. False if the period is zero, the hyperperiod overflows, or the
+     * table has not enough entries for the triggers over the hyperperiod. In this case the table is not changed.
+     */
+    bool add(Time period, const PeriodicSchedule& schedule);
+
+    /// @result The least common multiple of all periods compiled into the table.
+    Time getHyperperiod(void) const;
+
+    /// @result Number of trigger entries in the hyperperiod.
+    unsigned int getNumberOfEntries(void) const;
+
+protected:
+    /**
+     * Initialize an empty table.
+     * @param entries Storage of the table entries.
+     * @param numberOfEntries Number of entries in the storage.
+     */
+    PeriodicScheduleTable(PeriodicScheduleTableEntry* entries, unsigned int numberOfEntries);
+
+    /// Schedule which plays the compiled table
+    PeriodicSchedule schedule;
+};
+
+/**
+ * Provider of the storage for a periodic schedule table.
+ *
+ * @tparam numberOfEntries Maximal number of triggers activations in the hyperperiod of the table.
+ */
+template<unsigned int numberOfEntries>
+class PeriodicScheduleTableProvider : public PeriodicScheduleTable
+{
+public:
+    /// Initialize an empty table.
+    PeriodicScheduleTableProvider(void);
+
+protected:
+    /// Storage of the table entries
+    PeriodicScheduleTableEntry entries[numberOfEntries];
+};
+
+// --- implementation of provider ----
+
+template<unsigned int numberOfEntries>
+PeriodicScheduleTableProvider<numberOfEntries>::PeriodicScheduleTableProvider(void) :
+    PeriodicScheduleTable(entries, numberOfEntries)
+{
+}
+
 } // namespace Tasking
 
 #endif /* INCLUDE_TASKPERIODICSCHEDULE_H_ */
@@ -26,18 +26,107 @@
 namespace Tasking
 {
 
-/// Type to express a time in milliseconds. It can be a time point or time span.
-typedef uint64_t Time; // Over 500 million years are addressable without overflow
+/**
+ * Resolution of the tasking time as number of time ticks per second. The default is one tick per millisecond. Faster
+ * control loops or time outs below one millisecond need a resolution in microseconds (1000000) or nanoseconds
+ * (1000000000). The resolution is selected at build time and must be the same for the library and the application,
+ * e.g. by the build option timeResolution = ms | us | ns.
+ */
+#ifndef TASKING_TICKS_PER_SECOND
+#define TASKING_TICKS_PER_SECOND 1000u
+#endif
+
+/**
+ * Type to express a time in ticks of the build time resolution, by default milliseconds. It can be a time point or
+ * time span. Over 500 years are addressable without overflow even with nanosecond resolution.
+ */
+typedef uint64_t Time;
 
 /// Constant to specify end of time
 static const Time endOfTime = std::numeric_limits<Time>::max();
 
+/// Number of time ticks per second
+static const Time ticksPerSecond = TASKING_TICKS_PER_SECOND;
+
+static_assert((ticksPerSecond == 1000u) || (ticksPerSecond == 1000000u) || (ticksPerSecond == 1000000000u),
+              "Time resolution must be milliseconds, microseconds, or nanoseconds.");
+
+/**
+ * Convert a number of seconds into time ticks.
+ * @param seconds Time in seconds
+ * @return Time in ticks of the build time resolution
+ */
+constexpr Time
+fromSeconds(uint64_t seconds)
+{
+    return seconds * ticksPerSecond;
+}
+
+/**
+ * Convert a number of milliseconds into time ticks.
+ * @param milliseconds Time in milliseconds
+ * @return Time in ticks of the build time resolution
+ */
+constexpr Time
+fromMilliseconds(uint64_t milliseconds)
+{
+    return milliseconds * (ticksPerSecond / 1000u);
+}
+
+/**
+ * Convert a number of microseconds into time ticks. With millisecond resolution the result is truncated.
+ * @param microseconds Time in microseconds
+ * @return Time in ticks of the build time resolution
+ */
+constexpr Time
+fromMicroseconds(uint64_t microseconds)
+{
+    return (ticksPerSecond >= 1000000u) ? microseconds * (ticksPerSecond / 1000000u)
+                                        : microseconds / (1000000u / ticksPerSecond);
+}
+
+/**
+ * Convert a number of nanoseconds into time ticks. The result is truncated to the build time resolution.
+ * @param nanoseconds Time in nanoseconds
+ * @return Time in ticks of the build time resolution
+ */
+constexpr Time
+fromNanoseconds(uint64_t nanoseconds)
+{
+    return nanoseconds / (1000000000u / ticksPerSecond);
+}
+
+/**
+ * Convert time ticks into nanoseconds.
+ * @param time Time in ticks of the build time resolution
+ * @return Time in nanoseconds
+ */
+constexpr uint64_t
+toNanoseconds(Time time)
+{
+    return time * (1000000000u / ticksPerSecond);
+}
+
 /// Type to express the task ID.
 typedef uint32_t TaskId;
 
 /// Type to express the channel ID.
 typedef uint32_t ChannelId;
 
+/**
+ * Behavior of a periodic event when it is handled so late that the activation of its next period is already in the
+ * past.
+ */
+enum OverrunPolicy
+{
+    /// Fire the event for each missed period immediately one after the other (default)
+    catchUp,
+    /// Skip the missed periods and continue with the next period in the future
+    skipOverrun,
+    /// Skip the missed periods like skipOverrun, the late firing reports the number of missed periods
+    coalesceOverrun
+};
+
 } // namespace Tasking
 
 #endif /* TASKTYPES_H_ */
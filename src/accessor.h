@@ -38,6 +38,7 @@ struct TaskingAccessor
     bool associateTo(Tasking::Channel& channel, InputImpl& input) const;
     void deassociate(Tasking::Channel& channel, InputImpl& input) const;
     void reset(Tasking::Channel& channel) const;
+    bool freeze(Tasking::Channel& channel) const;
     void synchronizeStart(Tasking::Channel& channel, const Task* p_task, unsigned int volume) const;
     void synchronizeEnd(Tasking::Channel& channel, Task* p_task) const;
     void execute(Tasking::Task& task) const;
@@ -84,6 +85,11 @@ TaskingAccessor::reset(Tasking::Channel& channel) const
 {
     channel.reset();
 }
+inline bool
+TaskingAccessor::freeze(Tasking::Channel& channel) const
+{
+    return channel.freeze();
+}
 inline void
 TaskingAccessor::synchronizeStart(Tasking::Channel& channel, const Task* p_task, unsigned int volume) const
 {
@@ -17,6 +17,7 @@
  */
 
 #include <impl/clock_impl.h>
+#include <impl/clockTimingWheel_impl.h>
 #include <scheduler.h>
 #include <taskEvent.h>
 #include <taskUtils.h>
@@ -24,8 +25,11 @@
 #include "accessor.h"
 
 Tasking::Clock::Clock(Tasking::Scheduler& pScheduler) :
-    scheduler(pScheduler), queueHead(nullptr), queueTail(nullptr), nonePendingHead(nullptr)
+    scheduler(pScheduler), queueHead(nullptr), queueTail(nullptr), nonePendingHead(nullptr), timingWheel(nullptr),
+    nextWakeUpTime(0u)
 {
+    statistic.wakeUps = 0u;
+    statistic.firedEvents = 0u;
 }
 
 //-------------------------------------
@@ -51,23 +55,12 @@ Tasking::Clock::startAt(EventImpl& event, const Time time)
         // Queue only if not queued yet.
         if (!event.queued)
         {
-            // Set the correct next activation time
-            event.nextActivation_ms = time;
-            // Compute the new delay time for the timer. Usage of integer to handle past times implicit.
             Time currentTime = getTime();
-            delay = static_cast<int64_t>(time) - static_cast<int64_t>(currentTime);
-
-            // Take over into clock queue when delay is at least one millisecond, else schedule event
-            if (delay > 0u)
+            place(event, time, currentTime, shouldSignal, shouldStartTimer);
+            if (shouldStartTimer)
             {
-                // Enqueue in active list and start timer when event is the first future event
-                shouldStartTimer = enqueue(currentTime, event);
-            }
-            else
-            {
-                // Start event immediately or start point where in the past.
-                enqueueHead(event);
-                shouldSignal = true;
+                // The wake up can be later within the slack of the event
+                delay = static_cast<int64_t>(getNextStartTime()) - static_cast<int64_t>(currentTime);
             }
         }
     }
@@ -87,6 +80,68 @@ Tasking::Clock::startAt(EventImpl& event, const Time time)
 
 //-------------------------------------
 
+void
+Tasking::Clock::startAllAt(EventImpl* events, Time currentTime)
+{
+    // Signaling and start of the timer only once for all events and outside of critical section.
+    bool shouldSignal = false;
+    bool shouldStartTimer = false;
+    int64_t delay = 0u;
+
+    {
+        MutexGuard guard(timeQueueMutex);
+        for (EventImpl* event = events; event != nullptr; event = event->nextPending)
+        {
+            // Only periodic and postponed events are started again by the clock
+            if ((event->periodical || event->postponed) && !event->queued)
+            {
+                place(*event, event->nextActivation_ms, currentTime, shouldSignal, shouldStartTimer);
+            }
+        }
+        if (shouldStartTimer)
+        {
+            delay = static_cast<int64_t>(getNextStartTime()) - static_cast<int64_t>(currentTime);
+        }
+    }
+
+    if (shouldSignal)
+    {
+        TaskingAccessor().signal(scheduler);
+    }
+    if (shouldStartTimer)
+    {
+        startTimer(delay);
+    }
+}
+
+//-------------------------------------
+
+void
+Tasking::Clock::place(EventImpl& event, Time time, Time currentTime, bool& shouldSignal, bool& shouldStartTimer)
+{
+    // Set the correct next activation time
+    event.nextActivation_ms = time;
+    // Take over into clock queue when the time is at least one time tick in the future, else schedule event
+    if (time > currentTime)
+    {
+        // Enqueue in active list and start timer when event is the first future event. An event behind the first
+        // future event brings the wake up forward, when the end of its slack is before the wake up delayed by the
+        // slack of earlier events.
+        if (enqueue(currentTime, event) || ((time + event.slack_ms) < nextWakeUpTime))
+        {
+            shouldStartTimer = true;
+        }
+    }
+    else
+    {
+        // Start event immediately or start point where in the past.
+        enqueueHead(event);
+        shouldSignal = true;
+    }
+}
+
+//-------------------------------------
+
 void
 Tasking::Clock::startIn(EventImpl& event, const Time time)
 {
@@ -127,6 +182,10 @@ bool
 Tasking::Clock::enqueue(Time currentTime, EventImpl& event)
 {
     // Only called by startAt, so always inside protected area of timeQueueMutex
+    if (timingWheel != nullptr)
+    {
+        return timingWheel->insert(currentTime, event);
+    }
 
     bool firstFutureEvent = false;
 
@@ -225,6 +284,11 @@ void
 Tasking::Clock::enqueueHead(Tasking::EventImpl& event)
 {
     // Only called by startAt or startIn, so always inside protected area of timeQueueMutex
+    if (timingWheel != nullptr)
+    {
+        timingWheel->insertHead(event);
+        return;
+    }
 
     // If queue is not empty prepare head elements for enqueuing
     if (queueHead != nullptr)
@@ -263,6 +327,11 @@ Tasking::Clock::dequeueAll(void)
     // No further event will fire so none pending head will not valid anymore
     nonePendingHead = nullptr;
 
+    if (timingWheel != nullptr)
+    {
+        timingWheel->removeAll();
+    }
+
     // Reset pointers of all events in queue
     EventImpl* event = queueHead;
     while (event != nullptr)
@@ -271,6 +340,7 @@ Tasking::Clock::dequeueAll(void)
         event->queued = false;
         event->next = nullptr;
         event->previous = nullptr;
+        event->postponedActivation_ms = 0u;
         event = next;
     }
     // Clear head and tail
@@ -291,8 +361,12 @@ Tasking::Clock::dequeue(Tasking::EventImpl& event)
         nonePendingHead = event.next;
     }
 
+    if (timingWheel != nullptr)
+    {
+        timingWheel->remove(event);
+    }
     // If event queue is empty, do nothing
-    if (queueHead != nullptr)
+    else if (queueHead != nullptr)
     {
         // Find the element in the queue and it direct previous element
         EventImpl* current = queueHead;
@@ -353,6 +427,7 @@ Tasking::Clock::dequeue(Tasking::EventImpl& event)
     event.queued = false; // Mark as no longer queued
     event.next = nullptr;
     event.previous = nullptr;
+    event.postponedActivation_ms = 0u;
 }
 
 //-------------------------------------
@@ -361,19 +436,34 @@ bool
 Tasking::Clock::isEmtpy(void) const
 {
     MutexGuard guard(timeQueueMutex);
-    return (queueHead == nullptr);
+    return (timingWheel != nullptr) ? timingWheel->isEmpty() : (queueHead == nullptr);
 }
 
 //-------------------------------------
 
 bool
 Tasking::Clock::isPending(void) const
+{
+    Time currentTime;
+    return isPending(currentTime);
+}
+
+//-------------------------------------
+
+bool
+Tasking::Clock::isPending(Time& currentTime) const
 {
     MutexGuard guard(timeQueueMutex);
+    if (timingWheel != nullptr)
+    {
+        currentTime = getTime();
+        return timingWheel->isPending(currentTime);
+    }
     bool pends = (queueHead != nullptr);
     if (pends)
     {
-        pends = (queueHead->nextActivation_ms <= getTime());
+        currentTime = getTime();
+        pends = (queueHead->nextActivation_ms <= currentTime);
     }
     return pends;
 }
@@ -387,8 +477,12 @@ Tasking::Clock::readFirstPending(void)
 
     // Working on clock queue is critical
     MutexGuard guard(timeQueueMutex);
+    if (timingWheel != nullptr)
+    {
+        result = timingWheel->readFirstPending(getTime());
+    }
     // Only remove when one is pending.
-    if ((queueHead != nullptr) && (queueHead->nextActivation_ms <= getTime()))
+    else if ((queueHead != nullptr) && (queueHead->nextActivation_ms <= getTime()))
     {
         // If element is the first none pending event the hone pending head need replaced
         if (queueHead == nonePendingHead)
@@ -424,11 +518,87 @@ Tasking::Clock::readFirstPending(void)
         }
     }
 
+    if (result != nullptr)
+    {
+        ++statistic.firedEvents;
+    }
+
     return result;
 }
 
 //-------------------------------------
 
+Tasking::EventImpl*
+Tasking::Clock::takeAllPending(Time currentTime)
+{
+    EventImpl* first = nullptr;
+    EventImpl* last = nullptr;
+
+    // Working on clock queue is critical
+    MutexGuard guard(timeQueueMutex);
+    if (timingWheel != nullptr)
+    {
+        // The wheel delivers the pending events in order of time, chain them to the batch.
+        for (EventImpl* event = timingWheel->readFirstPending(currentTime); event != nullptr;
+             event = timingWheel->readFirstPending(currentTime))
+        {
+            event->nextPending = nullptr;
+            if (last == nullptr)
+            {
+                first = event;
+            }
+            else
+            {
+                last->nextPending = event;
+            }
+            last = event;
+            ++statistic.firedEvents;
+        }
+    }
+    // Only remove when at least one is pending.
+    else if ((queueHead != nullptr) && (queueHead->nextActivation_ms <= currentTime))
+    {
+        // Detach the pending prefix of the queue. It is already in order of the batch.
+        first = queueHead;
+        EventImpl* event = queueHead;
+        while ((event != nullptr) && (event->nextActivation_ms <= currentTime))
+        {
+            // The first none pending event can't be in the removed part anymore
+            if (event == nonePendingHead)
+            {
+                nonePendingHead = event->next;
+            }
+            EventImpl* next = event->next;
+            event->queued = false;
+            event->next = nullptr;
+            event->previous = nullptr;
+            event->nextPending = ((next != nullptr) && (next->nextActivation_ms <= currentTime)) ? next : nullptr;
+            ++statistic.firedEvents;
+            event = next;
+        }
+        // Remaining part of the queue starts with the first event in the future
+        queueHead = event;
+        if (nullptr == queueHead)
+        {
+            queueTail = nullptr;
+        }
+        else
+        {
+            // The new head block has no previous element. The remaining part has always a later time than the batch.
+            for (EventImpl* hasSameTime = queueHead;
+                 (hasSameTime != nullptr) && (hasSameTime->nextActivation_ms == queueHead->nextActivation_ms);
+                 hasSameTime = hasSameTime->next)
+            {
+                hasSameTime->previous = nullptr;
+            }
+        }
+    }
+
+    return first;
+}
+
+//-------------------------------------
+
 Tasking::Time
 Tasking::Clock::getNextStartTime(void)
 {
@@ -436,6 +606,12 @@ Tasking::Clock::getNextStartTime(void)
     Time currentTime = getTime();
     EventImpl* searchEvent = nullptr;
 
+    if (timingWheel != nullptr)
+    {
+        nextWakeUpTime = timingWheel->getNextStartTime(currentTime);
+        return nextWakeUpTime;
+    }
+
     // Search first event in the future. Start with the last one found by getNextStartTime.
     searchEvent = nonePendingHead;
     if (searchEvent == nullptr)
@@ -462,6 +638,23 @@ Tasking::Clock::getNextStartTime(void)
     // When loop ended by null pointer also reset of pending head happen.
     nonePendingHead = searchEvent;
 
+    // Delay the wake up to the earliest end of the slack of all events which are activated until the wake up, so all
+    // of them are fired by one wake up. Events later than the wake up can't reduce it, because the queue is sorted.
+    if (searchEvent != nullptr)
+    {
+        nextStartTime += searchEvent->slack_ms;
+        for (EventImpl* joinEvent = searchEvent->next;
+             (joinEvent != nullptr) && (joinEvent->nextActivation_ms <= nextStartTime); joinEvent = joinEvent->next)
+        {
+            if ((joinEvent->nextActivation_ms + joinEvent->slack_ms) < nextStartTime)
+            {
+                nextStartTime = joinEvent->nextActivation_ms + joinEvent->slack_ms;
+            }
+        }
+    }
+
+    // Remember the wake up, an event enqueued later can bring it forward
+    nextWakeUpTime = nextStartTime;
     return nextStartTime;
 }
 
@@ -471,6 +664,10 @@ Tasking::Time
 Tasking::Clock::getHeadTime(void) const
 {
     Time headTime = 0u;
+    if (timingWheel != nullptr)
+    {
+        return timingWheel->getHeadTime();
+    }
     EventImpl* head = queueHead;
     if (head != nullptr)
     {
@@ -478,3 +675,69 @@ Tasking::Clock::getHeadTime(void) const
     }
     return headTime;
 }
+
+//-------------------------------------
+
+void
+Tasking::Clock::reportWakeUp(void)
+{
+    MutexGuard guard(timeQueueMutex);
+    ++statistic.wakeUps;
+}
+
+//-------------------------------------
+
+void
+Tasking::Clock::readStatistic(Statistic& currentStatistic)
+{
+    MutexGuard guard(timeQueueMutex);
+    currentStatistic = statistic;
+    statistic.wakeUps = 0u;
+    statistic.firedEvents = 0u;
+}
+
+//-------------------------------------
+
+void
+Tasking::Clock::useTimingWheel(ClockTimingWheelImpl* wheel)
+{
+    MutexGuard guard(timeQueueMutex);
+    Time currentTime = getTime();
+    if (timingWheel == nullptr)
+    {
+        // Take over the sorted list in its order into the wheel
+        EventImpl* event = queueHead;
+        queueHead = nullptr;
+        queueTail = nullptr;
+        nonePendingHead = nullptr;
+        timingWheel = wheel;
+        while ((event != nullptr) && (timingWheel != nullptr))
+        {
+            EventImpl* next = event->next;
+            timingWheel->place(*event);
+            event = next;
+        }
+    }
+    else
+    {
+        // Sort all events of the wheel back into the list
+        EventImpl* events = nullptr;
+        timingWheel->removeAll(&events);
+        timingWheel = wheel;
+        while (events != nullptr)
+        {
+            EventImpl* next = events->next;
+            bool queued = events->queued;
+            if (timingWheel != nullptr)
+            {
+                timingWheel->place(*events);
+            }
+            else
+            {
+                enqueue(currentTime, *events);
+                events->queued = queued;
+            }
+            events = next;
+        }
+    }
+}
@@ -0,0 +1,455 @@
+/*
+ * clockTimingWheel.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <clockTimingWheel.h>
+#include <impl/clock_impl.h>
+#include <scheduler.h>
+
+#include "accessor.h"
+
+Tasking::ClockTimingWheel::ClockTimingWheel(Scheduler& scheduler) :
+    impl(TaskingAccessor().getImpl(scheduler).clock)
+{
+    impl.clock.useTimingWheel(&impl);
+}
+
+//-------------------------------------
+
+Tasking::ClockTimingWheel::~ClockTimingWheel(void)
+{
+    impl.clock.useTimingWheel(nullptr);
+}
+
+// ====================================
+
+Tasking::ClockTimingWheelImpl::ClockTimingWheelImpl(Clock& p_clock) :
+    clock(p_clock), cursor(p_clock.getTime()), nextStart(0u), nextStartValid(false)
+{
+    for (unsigned int slot = 0u; slot <= dueSlot; ++slot)
+    {
+        heads[slot] = nullptr;
+        tails[slot] = nullptr;
+    }
+    for (unsigned int level = 0u; level < levels; ++level)
+    {
+        occupied[level] = 0u;
+    }
+}
+
+//-------------------------------------
+
+bool
+Tasking::ClockTimingWheelImpl::insert(Time currentTime, EventImpl& event)
+{
+    event.queued = true;
+    place(event);
+
+    // Check against the cached next start time if the event becomes the first one in the future.
+    Time time = event.nextActivation_ms;
+    bool firstFutureEvent = false;
+    if (time > currentTime)
+    {
+        if (nextStartValid && (nextStart > currentTime))
+        {
+            firstFutureEvent = (time < nextStart);
+            if (firstFutureEvent)
+            {
+                nextStart = time;
+            }
+        }
+        else
+        {
+            // Unknown if there is an earlier event in the future
+            firstFutureEvent = true;
+            nextStartValid = false;
+        }
+    }
+    return firstFutureEvent;
+}
+
+//-------------------------------------
+
+void
+Tasking::ClockTimingWheelImpl::insertHead(EventImpl& event)
+{
+    event.wheelSlot = dueSlot;
+    event.previous = nullptr;
+    event.next = heads[dueSlot];
+    if (event.next != nullptr)
+    {
+        event.next->previous = &event;
+    }
+    else
+    {
+        tails[dueSlot] = &event;
+    }
+    heads[dueSlot] = &event;
+}
+
+//-------------------------------------
+
+void
+Tasking::ClockTimingWheelImpl::remove(EventImpl& event)
+{
+    if (event.wheelSlot != noSlot)
+    {
+        if (nextStartValid && (event.nextActivation_ms == nextStart))
+        {
+            nextStartValid = false;
+        }
+        unlink(event);
+    }
+}
+
+//-------------------------------------
+
+void
+Tasking::ClockTimingWheelImpl::removeAll(EventImpl** events)
+{
+    // Start with the due list to hand over the events roughly in order of their activation
+    for (unsigned int i = 0u; i <= dueSlot; ++i)
+    {
+        unsigned int slot = (i == 0u) ? dueSlot : i - 1u;
+        EventImpl* event = heads[slot];
+        while (event != nullptr)
+        {
+            EventImpl* next = event->next;
+            event->wheelSlot = noSlot;
+            event->previous = nullptr;
+            event->next = nullptr;
+            if (events != nullptr)
+            {
+                // Hand over at the tail of the list
+                *events = event;
+                events = &(event->next);
+            }
+            else
+            {
+                event->queued = false;
+            }
+            event = next;
+        }
+        heads[slot] = nullptr;
+        tails[slot] = nullptr;
+    }
+    for (unsigned int level = 0u; level < levels; ++level)
+    {
+        occupied[level] = 0u;
+    }
+    nextStartValid = false;
+}
+
+//-------------------------------------
+
+Tasking::EventImpl*
+Tasking::ClockTimingWheelImpl::readFirstPending(Time currentTime)
+{
+    EventImpl* result = nullptr;
+    if (isPending(currentTime))
+    {
+        result = heads[dueSlot];
+        unlink(*result);
+        result->queued = false;
+    }
+    return result;
+}
+
+//-------------------------------------
+
+bool
+Tasking::ClockTimingWheelImpl::isPending(Time currentTime)
+{
+    advance(currentTime);
+    return (heads[dueSlot] != nullptr) && (heads[dueSlot]->nextActivation_ms <= currentTime);
+}
+
+//-------------------------------------
+
+Tasking::Time
+Tasking::ClockTimingWheelImpl::getNextStartTime(Time currentTime)
+{
+    advance(currentTime);
+    // After advance all events in the slots are in the future
+    if (!nextStartValid || (nextStart <= currentTime))
+    {
+        nextStart = earliest();
+        nextStartValid = true;
+    }
+    return nextStart;
+}
+
+//-------------------------------------
+
+Tasking::Time
+Tasking::ClockTimingWheelImpl::getHeadTime(void) const
+{
+    Time headTime;
+    if (heads[dueSlot] != nullptr)
+    {
+        headTime = heads[dueSlot]->nextActivation_ms;
+    }
+    else
+    {
+        headTime = earliest();
+    }
+    return headTime;
+}
+
+//-------------------------------------
+
+bool
+Tasking::ClockTimingWheelImpl::isEmpty(void) const
+{
+    bool empty = (heads[dueSlot] == nullptr);
+    for (unsigned int level = 0u; empty && (level < levels); ++level)
+    {
+        empty = (occupied[level] == 0u);
+    }
+    return empty;
+}
+
+//-------------------------------------
+
+void
+Tasking::ClockTimingWheelImpl::advance(Time currentTime)
+{
+    const Time digitMask = slotsPerLevel - 1u;
+    while (cursor <= currentTime)
+    {
+        // Search the next occupied slot of the lowest level at or after the cursor
+        uint64_t ahead = occupied[0] & (~static_cast<uint64_t>(0u) << (cursor & digitMask));
+        if (ahead != 0u)
+        {
+            unsigned int digit = lowestBit(ahead);
+            Time slotTime = (cursor & ~digitMask) | digit;
+            if (slotTime > currentTime)
+            {
+                cursor = currentTime + 1u;
+            }
+            else
+            {
+                expire(digit);
+                cursor = slotTime + 1u;
+                // Crossing a slot boundary of higher levels, only the slot of the highest changed digit has events.
+                for (unsigned int level = 1u;
+                     (level < levels) && ((cursor & ((static_cast<Time>(1u) << (level * slotBits)) - 1u)) == 0u);
+                     ++level)
+                {
+                    cascade(level, (cursor >> (level * slotBits)) & digitMask);
+                }
+            }
+        }
+        else
+        {
+            // No further event in the lowest level, jump to the first occupied slot of the next occupied level.
+            unsigned int level = 1u;
+            while ((level < levels) && (occupied[level] == 0u))
+            {
+                ++level;
+            }
+            if (level == levels)
+            {
+                cursor = currentTime + 1u;
+            }
+            else
+            {
+                unsigned int shift = level * slotBits;
+                unsigned int digit = lowestBit(occupied[level]);
+                Time slotStart = static_cast<Time>(digit) << shift;
+                if ((shift + slotBits) < 64u)
+                {
+                    slotStart |= (cursor >> (shift + slotBits)) << (shift + slotBits);
+                }
+                if (slotStart > currentTime + 1u)
+                {
+                    cursor = currentTime + 1u;
+                }
+                else
+                {
+                    cursor = slotStart;
+                    cascade(level, digit);
+                }
+            }
+        }
+    }
+}
+
+//-------------------------------------
+
+void
+Tasking::ClockTimingWheelImpl::place(EventImpl& event)
+{
+    Time time = event.nextActivation_ms;
+    if (time < cursor)
+    {
+        append(dueSlot, event);
+    }
+    else
+    {
+        // Level is given by the highest digit which differs from the cursor
+        unsigned int level = 0u;
+        for (Time difference = (time ^ cursor) >> slotBits; difference != 0u; difference >>= slotBits)
+        {
+            ++level;
+        }
+        append((level * slotsPerLevel) + ((time >> (level * slotBits)) & (slotsPerLevel - 1u)), event);
+    }
+}
+
+//-------------------------------------
+
+void
+Tasking::ClockTimingWheelImpl::append(unsigned int slot, EventImpl& event)
+{
+    event.wheelSlot = slot;
+    event.next = nullptr;
+    event.previous = tails[slot];
+    if (tails[slot] != nullptr)
+    {
+        tails[slot]->next = &event;
+    }
+    else
+    {
+        heads[slot] = &event;
+        if (slot != dueSlot)
+        {
+            occupied[slot / slotsPerLevel] |= static_cast<uint64_t>(1u) << (slot % slotsPerLevel);
+        }
+    }
+    tails[slot] = &event;
+}
+
+//-------------------------------------
+
+void
+Tasking::ClockTimingWheelImpl::unlink(EventImpl& event)
+{
+    unsigned int slot = event.wheelSlot;
+    if (event.previous != nullptr)
+    {
+        event.previous->next = event.next;
+    }
+    else
+    {
+        heads[slot] = event.next;
+    }
+    if (event.next != nullptr)
+    {
+        event.next->previous = event.previous;
+    }
+    else
+    {
+        tails[slot] = event.previous;
+    }
+    if ((heads[slot] == nullptr) && (slot != dueSlot))
+    {
+        occupied[slot / slotsPerLevel] &= ~(static_cast<uint64_t>(1u) << (slot % slotsPerLevel));
+    }
+    event.wheelSlot = noSlot;
+    event.next = nullptr;
+    event.previous = nullptr;
+}
+
+//-------------------------------------
+
+void
+Tasking::ClockTimingWheelImpl::cascade(unsigned int level, unsigned int digit)
+{
+    unsigned int slot = (level * slotsPerLevel) + digit;
+    EventImpl* event = heads[slot];
+    heads[slot] = nullptr;
+    tails[slot] = nullptr;
+    occupied[level] &= ~(static_cast<uint64_t>(1u) << digit);
+    while (event != nullptr)
+    {
+        EventImpl* next = event->next;
+        place(*event);
+        event = next;
+    }
+}
+
+//-------------------------------------
+
+void
+Tasking::ClockTimingWheelImpl::expire(unsigned int digit)
+{
+    EventImpl* first = heads[digit];
+    for (EventImpl* event = first; event != nullptr; event = event->next)
+    {
+        event->wheelSlot = dueSlot;
+    }
+    // Splice the slot to the tail of the due list
+    first->previous = tails[dueSlot];
+    if (tails[dueSlot] != nullptr)
+    {
+        tails[dueSlot]->next = first;
+    }
+    else
+    {
+        heads[dueSlot] = first;
+    }
+    tails[dueSlot] = tails[digit];
+    heads[digit] = nullptr;
+    tails[digit] = nullptr;
+    occupied[0] &= ~(static_cast<uint64_t>(1u) << digit);
+}
+
+//-------------------------------------
+
+Tasking::Time
+Tasking::ClockTimingWheelImpl::earliest(void) const
+{
+    Time earliestTime = 0u;
+    unsigned int level = 0u;
+    while ((level < levels) && (occupied[level] == 0u))
+    {
+        ++level;
+    }
+    if (level == 0u)
+    {
+        // Slots of the lowest level hold events with exactly the same time
+        earliestTime = (cursor & ~static_cast<Time>(slotsPerLevel - 1u)) | lowestBit(occupied[0]);
+    }
+    else if (level < levels)
+    {
+        // Events in slots of higher levels are not ordered, search the first occupied slot
+        EventImpl* event = heads[(level * slotsPerLevel) + lowestBit(occupied[level])];
+        earliestTime = event->nextActivation_ms;
+        for (event = event->next; event != nullptr; event = event->next)
+        {
+            if (event->nextActivation_ms < earliestTime)
+            {
+                earliestTime = event->nextActivation_ms;
+            }
+        }
+    }
+    return earliestTime;
+}
+
+//-------------------------------------
+
+unsigned int
+Tasking::ClockTimingWheelImpl::lowestBit(uint64_t bits)
+{
+    // De Bruijn sequence to map the isolated lowest bit to its position
+    static const unsigned char positions[64] = {
+            0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,  62, 55, 59, 36, 53, 51,
+            43, 22, 45, 39, 33, 30, 24, 18, 12, 5,  63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21,
+            44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6};
+    return positions[((bits & (~bits + 1u)) * 0x03f79d71b4cb0a89u) >> 58u];
+}
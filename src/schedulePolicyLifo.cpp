@@ -40,8 +40,9 @@ Tasking::SchedulePolicyLifo::queue(Tasking::TaskImpl& task)
     if (head != nullptr)
     {
         isEmpty = false;
-        static_cast<ManagementData*>(task.policyData)->next = head;
     }
+    // Always overwrite the link, a stale link from a previous run would put executed tasks back into the queue
+    static_cast<ManagementData*>(task.policyData)->next = head;
     head = &task;
     queueMutex.leave();
     return isEmpty;
@@ -0,0 +1,107 @@
+/*
+ * schedulePolicySharded.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <cstdint>
+
+#include <schedulePolicySharded.h>
+#include <task.h>
+
+Tasking::SchedulePolicySharded::Shard
+Tasking::SchedulePolicySharded::shardByGroup(const TaskImpl& task)
+{
+    Shard shard;
+    if (task.group != nullptr)
+    {
+        // Mix the address of the group, groups laid out in an array would otherwise fall to the same shards.
+        uint32_t value = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(task.group) / sizeof(void*));
+        value = (value ^ (value >> 16u)) * 0x45d9f3bu;
+        shard = static_cast<Shard>(value ^ (value >> 16u));
+    }
+    else
+    {
+        shard = shardByTaskId(task);
+    }
+    return shard;
+}
+
+// ----------------
+
+Tasking::SchedulePolicySharded::Shard
+Tasking::SchedulePolicySharded::shardByTaskId(const TaskImpl& task)
+{
+    return static_cast<Shard>(task.parent.getTaskId());
+}
+
+// ----------------
+
+Tasking::SchedulePolicySharded::SchedulePolicySharded(SchedulePolicy** p_shards, unsigned int p_numberOfShards,
+                                                      ShardFunction p_shardFunction) :
+    shards(p_shards), numberOfShards(p_numberOfShards), shardFunction(p_shardFunction), nextShard(0u)
+{
+    assert(numberOfShards > 0u);
+}
+
+// ----------------
+
+bool
+Tasking::SchedulePolicySharded::queue(Tasking::TaskImpl& task)
+{
+    return shards[selectShard(task)]->queue(task);
+}
+
+// ----------------
+
+Tasking::TaskImpl*
+Tasking::SchedulePolicySharded::nextTask(void)
+{
+    Shard start = nextShard;
+    nextShard = (start + 1u) % numberOfShards;
+    return scan(start);
+}
+
+// ----------------
+
+Tasking::TaskImpl*
+Tasking::SchedulePolicySharded::nextTaskFor(unsigned int executorIndex)
+{
+    return scan(executorIndex % numberOfShards);
+}
+
+// ----------------
+
+Tasking::SchedulePolicySharded::Shard
+Tasking::SchedulePolicySharded::selectShard(const Tasking::TaskImpl& task) const
+{
+    return shardFunction(task) % numberOfShards;
+}
+
+// ----------------
+
+Tasking::TaskImpl*
+Tasking::SchedulePolicySharded::scan(Shard start)
+{
+    TaskImpl* task = nullptr;
+    Shard shard = start;
+    for (unsigned int i = 0u; (task == nullptr) && (i < numberOfShards); ++i)
+    {
+        task = shards[shard]->nextTask();
+        shard = (shard + 1u == numberOfShards) ? 0u : shard + 1u;
+    }
+    return task;
+}
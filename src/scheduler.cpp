@@ -86,6 +86,18 @@ Tasking::Scheduler::initialize(void)
     {
         TaskingAccessor().initialize(task->parent);
     }
+    // The inputs are configured by the tasks, so channels with a fan-out storage can freeze their inputs now.
+    for (TaskImpl* task = impl.associatedTasks; task != nullptr; task = task->nextTaskAtScheduler)
+    {
+        for (unsigned int i = 0u; i < task->inputs.size(); ++i)
+        {
+            Channel* channel = task->inputs[i].getChannel<Channel>();
+            if (channel != nullptr)
+            {
+                TaskingAccessor().freeze(*channel);
+            }
+        }
+    }
 }
 
 // ====================================
@@ -113,9 +125,22 @@ Tasking::SchedulerImpl::perform(Tasking::TaskImpl& task)
     // Do only something when the scheduler is running.
     if (running)
     {
-        // Queue task for execution and signal scheduler execution model
-        policy.queue(task);
-        TaskingAccessor().signal(parent);
+        // A fused task is executed by the executor of its predecessor if the predecessor is currently executed.
+        bool deferred = false;
+        TaskImpl* predecessor = task.fusedPredecessor;
+        if (predecessor != nullptr)
+        {
+            predecessor->taskMutex.enter();
+            deferred = predecessor->executing;
+            task.fusedPending = deferred;
+            predecessor->taskMutex.leave();
+        }
+        if (!deferred)
+        {
+            // Queue task for execution and signal scheduler execution model
+            policy.queue(task);
+            TaskingAccessor().signal(parent);
+        }
     }
 }
 
@@ -124,11 +149,52 @@ Tasking::SchedulerImpl::perform(Tasking::TaskImpl& task)
 void
 Tasking::SchedulerImpl::handleEvents(void)
 {
-    EventImpl* event = clock.readFirstPending();
-    while (event != nullptr)
+    handleEvents(clock.getTime());
+}
+
+// ------------------------------------
+
+void
+Tasking::SchedulerImpl::handleEvents(Time currentTime)
+{
+    MutexGuard guard(handleEventsMutex);
+
+    // Take all pending events at once, events getting pending during the handling are taken by a further batch. The
+    // time is requested once per batch and used to take and to restart the events.
+    EventImpl* events = clock.takeAllPending(currentTime);
+    if (events != nullptr)
+    {
+        // All events pending at this time are handled by one wake up
+        clock.reportWakeUp();
+    }
+    while (events != nullptr)
     {
-        event->handle();
-        event = clock.readFirstPending();
+        // Compute the next activation of all periodic and postponed events and start them with one access to the
+        // clock queue. The events are protected until they are queued again, so they can't be modified concurrently.
+        for (EventImpl* event = events; event != nullptr; event = event->nextPending)
+        {
+            event->mutex.enter();
+            event->prepareRestart();
+        }
+        clock.startAllAt(events, currentTime);
+        for (EventImpl* event = events; event != nullptr; event = event->nextPending)
+        {
+            event->mutex.leave();
+        }
+
+        // Fire the events after all are queued again. Postponed events are not due yet.
+        EventImpl* event = events;
+        while (event != nullptr)
+        {
+            EventImpl* next = event->nextPending;
+            if (!event->postponed)
+            {
+                event->fire();
+            }
+            event = next;
+        }
+        currentTime = clock.getTime();
+        events = clock.takeAllPending(currentTime);
     }
 }
 
@@ -141,9 +207,45 @@ Tasking::SchedulerImpl::execute(Tasking::TaskImpl& task) const
     synchronizationMutex.enter();
     uptask->synchronizeStart();
     synchronizationMutex.leave();
-    TaskingAccessor().execute(uptask->parent);
+    // Execute the task and all fused successors which are activated during the execution of their predecessor.
+    bool chained;
+    do
+    {
+        TaskImpl* successor = uptask->fusedSuccessor;
+        if (successor != nullptr)
+        {
+            uptask->taskMutex.enter();
+            uptask->executing = true;
+            uptask->taskMutex.leave();
+        }
+        TaskingAccessor().execute(uptask->parent);
+        chained = false;
+        if (successor != nullptr)
+        {
+            uptask->taskMutex.enter();
+            uptask->executing = false;
+            chained = successor->fusedPending && running;
+            successor->fusedPending = false;
+            uptask->taskMutex.leave();
+        }
+        if (chained)
+        {
+            // Hand over from predecessor to successor in one critical section
+            synchronizationMutex.enter();
+            uptask->synchronizeEnd();
+            successor->synchronizeStart();
+            synchronizationMutex.leave();
+            uptask = successor;
+        }
+    } while (chained);
     synchronizationMutex.enter();
     uptask->synchronizeEnd();
-    uptask->finalizeExecution();
+    // Finalize the executed chain in order of execution.
+    TaskImpl* last = uptask;
+    for (uptask = &task; uptask != last; uptask = uptask->fusedSuccessor)
+    {
+        uptask->finalizeExecution();
+    }
+    last->finalizeExecution();
     synchronizationMutex.leave();
 }
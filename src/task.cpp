@@ -108,6 +108,27 @@ Tasking::Task::reset(void)
 
 //-------------------------------------
 
+bool
+Tasking::Task::fuse(Task& successor)
+{
+    TaskImpl& next = successor.impl;
+    bool success = (&next != &impl) && (&next.associatedScheduler == &impl.associatedScheduler) &&
+                   (next.inputs.size() == 1u) && (impl.fusedSuccessor == nullptr) && (next.fusedPredecessor == nullptr);
+    // A fusion must not close a cycle, search the successor in the chain in front of this task.
+    for (TaskImpl* task = impl.fusedPredecessor; success && (task != nullptr); task = task->fusedPredecessor)
+    {
+        success = (task != &next);
+    }
+    if (success)
+    {
+        impl.fusedSuccessor = &next;
+        next.fusedPredecessor = &impl;
+    }
+    return success;
+}
+
+//-------------------------------------
+
 Tasking::TaskId
 Tasking::Task::getTaskId(void) const
 {
@@ -140,7 +161,11 @@ Tasking::TaskImpl::TaskImpl(Scheduler& scheduler, SchedulePolicy::ManagementData
     nextTaskAtScheduler(nullptr),
     associatedScheduler(scheduler),
     policyData(&policy),
-    group(nullptr)
+    group(nullptr),
+    fusedSuccessor(nullptr),
+    fusedPredecessor(nullptr),
+    executing(false),
+    fusedPending(false)
 {
     TaskingAccessor().getImpl(scheduler).add(*this);
 }
@@ -20,7 +20,8 @@
 #include <taskInput.h>
 #include <taskUtils.h>
 
-Tasking::Channel::Channel(ChannelId channelId) : m_channelId(channelId), m_inputs(nullptr)
+Tasking::Channel::Channel(ChannelId channelId) :
+    m_channelId(channelId), m_inputs(nullptr), m_fanOut(nullptr), m_tap(nullptr)
 {
     // For channel identification 0 channel identification is number of instantiated channels yet.
     static ChannelId channelCount = 1u;
@@ -33,7 +34,8 @@ Tasking::Channel::Channel(ChannelId channelId) : m_channelId(channelId), m_input
 
 //-------------------------------------
 
-Tasking::Channel::Channel(const char* channelName) : m_channelId(getChannelIdFromName(channelName)), m_inputs(nullptr)
+Tasking::Channel::Channel(const char* channelName) :
+    m_channelId(getChannelIdFromName(channelName)), m_inputs(nullptr), m_fanOut(nullptr), m_tap(nullptr)
 {
 }
 
@@ -45,6 +47,12 @@ Tasking::Channel::~Channel(void)
 
 //-------------------------------------
 
+Tasking::ChannelTap::~ChannelTap(void)
+{
+}
+
+//-------------------------------------
+
 bool
 Tasking::Channel::associateTo(Tasking::InputImpl& p_input)
 {
@@ -58,6 +66,8 @@ Tasking::Channel::associateTo(Tasking::InputImpl& p_input)
     }
     if (inputIsUnique)
     {
+        // The frozen states do not contain the new input
+        thaw();
         // p_input becomes the new head of the input list.
         p_input.channelNextInput = m_inputs;
         m_inputs = &p_input;
@@ -70,6 +80,7 @@ Tasking::Channel::associateTo(Tasking::InputImpl& p_input)
 void
 Tasking::Channel::deassociate(Tasking::InputImpl& p_input)
 {
+    thaw();
     // Check if input is head of the link list
     if (&p_input == m_inputs)
     {
@@ -98,9 +109,49 @@ Tasking::Channel::deassociate(Tasking::InputImpl& p_input)
 void
 Tasking::Channel::push(void)
 {
-    for (InputImpl* i = m_inputs; i != nullptr; i = i->channelNextInput)
+    pushData(nullptr, 0u);
+}
+
+//-------------------------------------
+
+void
+Tasking::Channel::pushData(const void* data, size_t size)
+{
+    tap(data, size);
+    if ((m_fanOut != nullptr) && (m_fanOut->size > 0u))
+    {
+        for (unsigned int i = 0u; i < m_fanOut->size; ++i)
+        {
+            m_fanOut->states[i].notify(1u);
+        }
+    }
+    else
+    {
+        for (InputImpl* i = m_inputs; i != nullptr; i = i->channelNextInput)
+        {
+            i->notifyInput();
+        }
+    }
+}
+
+//-------------------------------------
+
+void
+Tasking::Channel::pushBatch(unsigned int count)
+{
+    if ((count > 0u) && (m_fanOut != nullptr) && (m_fanOut->size > 0u))
     {
-        i->notifyInput();
+        for (unsigned int i = 0u; i < m_fanOut->size; ++i)
+        {
+            m_fanOut->states[i].notify(count);
+        }
+    }
+    else if (count > 0u)
+    {
+        for (InputImpl* i = m_inputs; i != nullptr; i = i->channelNextInput)
+        {
+            i->notifyInput(count);
+        }
     }
 }
 
@@ -129,6 +180,69 @@ Tasking::Channel::reset()
 
 //-------------------------------------
 
+void
+Tasking::Channel::setFanOut(Tasking::ChannelFanOut& fanOut)
+{
+    thaw();
+    m_fanOut = &fanOut;
+}
+
+//-------------------------------------
+
+void
+Tasking::Channel::setTap(Tasking::ChannelTap* p_tap)
+{
+    m_tap = p_tap;
+}
+
+//-------------------------------------
+
+bool
+Tasking::Channel::freeze(void)
+{
+    bool frozen = false;
+    if (m_fanOut != nullptr)
+    {
+        frozen = (m_fanOut->size > 0u);
+        if (!frozen)
+        {
+            unsigned int numberOfInputs = 0u;
+            for (InputImpl* i = m_inputs; i != nullptr; i = i->channelNextInput)
+            {
+                ++numberOfInputs;
+            }
+            // Inputs which do not fit into the storage remain in the list
+            if ((numberOfInputs > 0u) && (numberOfInputs <= m_fanOut->capacity))
+            {
+                for (InputImpl* i = m_inputs; i != nullptr; i = i->channelNextInput)
+                {
+                    i->freeze(m_fanOut->states[m_fanOut->size]);
+                    ++m_fanOut->size;
+                }
+                frozen = true;
+            }
+        }
+    }
+    return frozen;
+}
+
+//-------------------------------------
+
+void
+Tasking::Channel::thaw(void)
+{
+    if ((m_fanOut != nullptr) && (m_fanOut->size > 0u))
+    {
+        for (InputImpl* i = m_inputs; i != nullptr; i = i->channelNextInput)
+        {
+            i->thaw();
+        }
+        m_fanOut->size = 0u;
+    }
+}
+
+//-------------------------------------
+
 Tasking::ChannelId
 Tasking::Channel::getChannelId(void) const
 {
@@ -150,3 +264,10 @@ Tasking::Channel::setChannelId(ChannelId newChannelId)
 {
     m_channelId = newChannelId;
 }
+
+// ====================================
+
+Tasking::ChannelFanOut::ChannelFanOut(Tasking::InputState* p_states, unsigned int numberOfStates) :
+    states(p_states), capacity(numberOfStates), size(0u)
+{
+}
@@ -22,6 +22,7 @@
 #include <taskUtils.h>
 #include <scheduler.h>
 #include <impl/clock_impl.h>
+#include <impl/clockTimingWheel_impl.h>
 
 #include "accessor.h"
 
@@ -78,7 +79,7 @@ Tasking::Event::setPeriodicSchedule(const Time period, const Time offset, Period
     // Set the schedule and use normal timing set up
     impl.setPeriodicSchedule(schedule);
     // Has periodic schedule a non empty list of triggers? If not, clean event up because it won't work.
-    if (impl.periodicSchedule->triggers != nullptr)
+    if (!impl.periodicSchedule->isEmpty())
     {
         impl.configurePeriodicTiming(period, offset);
 
@@ -110,6 +111,15 @@ Tasking::Event::setPeriodicSchedule(const Time period, const Time offset, Period
 
 //-------------------------------------
 
+void
+Tasking::Event::setPeriodicSchedule(const Time offset, PeriodicScheduleTable& table)
+{
+    // The compiled table is played with its hyperperiod as period
+    setPeriodicSchedule(table.getHyperperiod(), offset, table.schedule);
+}
+
+//-------------------------------------
+
 void
 Tasking::Event::setRelativeTiming(const Time delay)
 {
@@ -162,6 +172,62 @@ Tasking::Event::trigger(const Tasking::Time time)
 
 //-------------------------------------
 
+void
+Tasking::Event::setSlack(const Tasking::Time slack)
+{
+    // The slack is read by the clock with protection of the clock queue, when the next wake up time is computed
+    MutexGuard guard(impl.clock.timeQueueMutex);
+    impl.slack_ms = slack;
+}
+
+//-------------------------------------
+
+void
+Tasking::Event::restart(const Tasking::Time time)
+{
+    // Do only something if it is not configured
+    if (!impl.configured)
+    {
+        impl.mutex.enter();
+        impl.restartIn(time);
+        impl.mutex.leave();
+    }
+}
+
+//-------------------------------------
+
+void
+Tasking::Event::setOverrunPolicy(const Tasking::OverrunPolicy policy)
+{
+    impl.mutex.enter();
+    impl.overrunPolicy = policy;
+    impl.mutex.leave();
+}
+
+//-------------------------------------
+
+unsigned int
+Tasking::Event::getSkippedPeriods(void) const
+{
+    impl.mutex.enter();
+    unsigned int result = impl.skippedPeriods;
+    impl.mutex.leave();
+    return result;
+}
+
+//-------------------------------------
+
+unsigned int
+Tasking::Event::getMissedPeriods(void) const
+{
+    impl.mutex.enter();
+    unsigned int result = impl.missedPeriods;
+    impl.mutex.leave();
+    return result;
+}
+
+//-------------------------------------
+
 bool
 Tasking::Event::isTriggered(void) const
 {
@@ -244,10 +310,18 @@ Tasking::EventImpl::EventImpl(Event& event, Scheduler& scheduler) :
     queued(false),
     period_ms(0),
     nextActivation_ms(0),
+    slack_ms(0),
+    postponedActivation_ms(0),
+    postponed(false),
+    overrunPolicy(catchUp),
+    skippedPeriods(0u),
+    missedPeriods(0u),
     periodicSchedule(nullptr),
     clock(TaskingAccessor().getImpl(scheduler).clock),
     next(nullptr),
     previous(nullptr),
+    nextPending(nullptr),
+    wheelSlot(ClockTimingWheelImpl::noSlot),
     mutexLock(false)
 {
 }
@@ -255,26 +329,92 @@ Tasking::EventImpl::EventImpl(Event& event, Scheduler& scheduler) :
 //-------------------------------------
 
 void
-Tasking::EventImpl::handle(void)
+Tasking::EventImpl::restartIn(const Time time)
 {
-    // If the event is periodic the next wake up time should hand over to the clock
-    mutex.enter();
-    if (periodical)
+    Time activation = clock.getTime() + time;
+    if (queued && (time != 0u) && (activation >= nextActivation_ms))
     {
-        if (nullptr == periodicSchedule)
+        // Keep the earlier queue entry, it is queued again for the postponed time when it is due
+        postponedActivation_ms = activation;
+    }
+    else
+    {
+        if (queued)
         {
-            // No periodic schedule to play, jump to next period
-            clock.startAt(*this, (nextActivation_ms + period_ms)); // If trigger is called now clock are out of order.
+            clock.dequeue(*this);
         }
-        else
+        postponedActivation_ms = 0u;
+        clock.startIn(*this, time);
+    }
+}
+
+//-------------------------------------
+
+bool
+Tasking::EventImpl::prepareRestart(void)
+{
+    // An event queued again since it was taken from the clock queue keeps its activation time
+    postponed = !queued && (postponedActivation_ms > nextActivation_ms);
+    if (queued)
+    {
+        return false;
+    }
+    if (postponed)
+    {
+        nextActivation_ms = postponedActivation_ms;
+    }
+    else if (periodical)
+    {
+        nextActivation_ms = stepToNextActivation();
+    }
+    postponedActivation_ms = 0u;
+    return postponed || periodical;
+}
+
+//-------------------------------------
+
+Tasking::Time
+Tasking::EventImpl::stepToNextActivation(void)
+{
+    Time nextActivation;
+    unsigned int missed = 0u;
+    if (nullptr == periodicSchedule)
+    {
+        // No periodic schedule to play, jump to next period
+        nextActivation = nextActivation_ms + period_ms;
+        Time currentTime = (overrunPolicy != catchUp) ? clock.getTime() : 0u;
+        if ((overrunPolicy != catchUp) && (nextActivation <= currentTime) && (period_ms != 0u))
         {
-            // Play periodic schedule
-            periodicSchedule->pushTriggers();
-            clock.startAt(*this, periodicSchedule->stepToNextTriggerOffset());
+            // Jump over the periods in the past to the first period after the current time. A period due now is
+            // covered by the late firing too, so the event fires only once.
+            Time periods = ((currentTime - nextActivation) / period_ms) + 1u;
+            nextActivation += periods * period_ms;
+            missed = static_cast<unsigned int>(periods);
         }
     }
-    mutex.leave();
+    else
+    {
+        // Play periodic schedule
+        periodicSchedule->pushTriggers();
+        nextActivation = periodicSchedule->stepToNextTriggerOffset();
+        Time currentTime = (overrunPolicy != catchUp) ? clock.getTime() : 0u;
+        while ((overrunPolicy != catchUp) && (nextActivation <= currentTime))
+        {
+            // Step over trigger offsets in the past without a push of the triggers
+            nextActivation = periodicSchedule->stepToNextTriggerOffset();
+            missed++;
+        }
+    }
+    skippedPeriods += missed;
+    missedPeriods = (overrunPolicy == coalesceOverrun) ? missed : 0u;
+    return nextActivation;
+}
+
+//-------------------------------------
 
+void
+Tasking::EventImpl::fire(void)
+{
     if (parent.shallFire())
     {
         parent.onFire();
@@ -289,6 +429,7 @@ void
 Tasking::EventImpl::setPeriodicSchedule(PeriodicSchedule& schedule)
 {
     periodicSchedule = &schedule.impl;
+    periodicSchedule->rewind();
 }
 
 //-------------------------------------
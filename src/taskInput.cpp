@@ -46,9 +46,10 @@ Tasking::Input::configure(Channel& channel, unsigned int activations, bool final
 void
 Tasking::Input::configure(unsigned int activations, bool final)
 {
-    impl.m_activationThreshold = activations;
-    impl.m_final = final;
-    impl.m_synchron = (impl.m_activationThreshold > 0u); // For optional inputs no synchronization is available
+    InputState& state = *impl.m_state;
+    state.m_activationThreshold = activations;
+    state.m_final = final;
+    state.m_synchron = (state.m_activationThreshold > 0u); // For optional inputs no synchronization is available
 }
 
 //-------------------------------------
@@ -56,25 +57,26 @@ Tasking::Input::configure(unsigned int activations, bool final)
 void
 Tasking::Input::setSynchron(bool syncState)
 {
+    InputState& state = *impl.m_state;
     // For optional inputs, no synchronization is available
-    impl.m_synchron = syncState && (impl.m_activationThreshold > 0u);
+    state.m_synchron = syncState && (state.m_activationThreshold > 0u);
     // In one task run the task consumes in synchronous mode only the threshold value, in asynchronous mode all messages
-    if (impl.m_synchron)
+    if (state.m_synchron)
     {
         // When the input has enough notification to activate a task, ...
-        if (impl.m_notifications > impl.m_activationThreshold)
+        if (state.m_notifications > state.m_activationThreshold)
         {
             // ... distribute the notifications on pending ones and the one which had activate the task.
-            impl.m_missedNotifications = impl.m_notifications - impl.m_activationThreshold;
-            impl.m_notifications = impl.m_activationThreshold;
+            state.m_missedNotifications = state.m_notifications - state.m_activationThreshold;
+            state.m_notifications = state.m_activationThreshold;
         }
     }
     else
     {
         // In asynchronous mode there are no missed notifications.
         // Adjust values to the expected state as with all notifications in asynchronous mode.
-        impl.m_notifications += impl.m_missedNotifications;
-        impl.m_missedNotifications = 0u;
+        state.m_notifications += state.m_missedNotifications;
+        state.m_missedNotifications = 0u;
     }
 }
 
@@ -104,7 +106,7 @@ Tasking::Input::deassociate(void)
 void
 Tasking::Input::connectTask(TaskImpl& task)
 {
-    impl.m_task = &task;
+    impl.m_state->m_task = &task;
 }
 
 //-------------------------------------
@@ -112,36 +114,37 @@ Tasking::Input::connectTask(TaskImpl& task)
 void
 Tasking::Input::reset(void)
 {
+    InputState& state = *impl.m_state;
     // If connected to a channel, than reset the channel
     if (impl.m_channel != nullptr)
     {
         TaskingAccessor().reset(*impl.m_channel);
     }
     // When configured as synchronized, the missed activations has to be overtaken
-    if (impl.m_synchron)
+    if (state.m_synchron)
     {
-        impl.m_mutex.enter();
+        state.m_mutex.enter();
         // Check if a new activation of a connected task should happen by the missed activation calls.
-        if ((impl.m_missedNotifications >= impl.m_activationThreshold))
+        if ((state.m_missedNotifications >= state.m_activationThreshold))
         {
             // Activation is necessary, so overtake the new bunch of activations and activate the task.
-            impl.m_missedNotifications -= impl.m_activationThreshold;
-            impl.m_notifications = impl.m_activationThreshold;
-            impl.m_mutex.leave();
-            impl.m_task->activate();
+            state.m_missedNotifications -= state.m_activationThreshold;
+            state.m_notifications = state.m_activationThreshold;
+            state.m_mutex.leave();
+            state.m_task->activate();
         }
         else
         {
             // No activation is necessary
-            impl.m_notifications = impl.m_missedNotifications;
-            impl.m_missedNotifications = 0u;
-            impl.m_mutex.leave();
+            state.m_notifications = state.m_missedNotifications;
+            state.m_missedNotifications = 0u;
+            state.m_mutex.leave();
         }
     }
     else
     {
         // Not synchronized, only reset activations.
-        impl.m_notifications = 0;
+        state.m_notifications = 0;
     }
 }
 
@@ -150,18 +153,7 @@ Tasking::Input::reset(void)
 bool
 Tasking::Input::isActivated(void) const
 {
-    bool isActive = false;
-
-    // First case: optional input marked as final, activate only if push came
-    if (impl.m_final && (impl.m_activationThreshold == 0))
-    {
-        isActive = (impl.m_notifications > 0);
-    }
-    else
-    {
-        isActive = (impl.m_notifications >= impl.m_activationThreshold);
-    }
-    return isActive;
+    return impl.m_state->isActivated();
 }
 
 //-------------------------------------
@@ -169,7 +161,7 @@ Tasking::Input::isActivated(void) const
 bool
 Tasking::Input::isOptional(void) const
 {
-    return (impl.m_activationThreshold == 0);
+    return (impl.m_state->m_activationThreshold == 0);
 }
 
 //-------------------------------------
@@ -177,7 +169,7 @@ Tasking::Input::isOptional(void) const
 bool
 Tasking::Input::isFinal(void) const
 {
-    return impl.m_final;
+    return impl.m_state->m_final;
 }
 
 //-------------------------------------
@@ -185,8 +177,8 @@ Tasking::Input::isFinal(void) const
 bool
 Tasking::Input::isValid(void) const
 {
-    return (impl.m_activationThreshold != impl.uninitialized) && (impl.m_channel != nullptr) &&
-           (impl.m_task != nullptr);
+    return (impl.m_state->m_activationThreshold != InputState::uninitialized) && (impl.m_channel != nullptr) &&
+           (impl.m_state->m_task != nullptr);
 }
 
 //-------------------------------------
@@ -194,7 +186,7 @@ Tasking::Input::isValid(void) const
 unsigned int
 Tasking::Input::getNotifications(void) const
 {
-    return impl.m_notifications;
+    return impl.m_state->m_notifications;
 }
 
 //-------------------------------------
@@ -202,50 +194,82 @@ Tasking::Input::getNotifications(void) const
 unsigned int
 Tasking::Input::getPendingNotifications(void) const
 {
-    return impl.m_missedNotifications;
-}
-
-//-------------------------------------
-
-Tasking::Channel*
-Tasking::InputImpl::getChannel(void) const
-{
-    return m_channel;
+    return impl.m_state->m_missedNotifications;
 }
 
 // ====================================
 
-Tasking::InputImpl::InputImpl(Tasking::Input& api) :
-    parent(api),
+Tasking::InputState::InputState(void) :
     m_task(nullptr),
-    m_channel(nullptr),
-    m_final(false),
-    m_synchron(false),
     m_notifications(0),
     m_missedNotifications(0u),
     m_activationThreshold(uninitialized),
-    channelNextInput(nullptr)
+    m_final(false),
+    m_synchron(false)
 {
 }
 
 //-------------------------------------
 
 void
-Tasking::InputImpl::notifyInput(void)
+Tasking::InputState::assign(const Tasking::InputState& other)
+{
+    m_task = other.m_task;
+    m_notifications = other.m_notifications;
+    m_missedNotifications = other.m_missedNotifications;
+    m_activationThreshold = other.m_activationThreshold;
+    m_final = other.m_final;
+    m_synchron = other.m_synchron;
+}
+
+//-------------------------------------
+
+bool
+Tasking::InputState::isActivated(void) const
+{
+    bool isActive = false;
+
+    // First case: optional input marked as final, activate only if push came
+    if (m_final && (m_activationThreshold == 0))
+    {
+        isActive = (m_notifications > 0);
+    }
+    else
+    {
+        isActive = (m_notifications >= m_activationThreshold);
+    }
+    return isActive;
+}
+
+//-------------------------------------
+
+void
+Tasking::InputState::notify(unsigned int count)
 {
     if (m_synchron)
     {
         m_mutex.enter();
-        if (parent.isActivated())
+        if (isActivated())
         {
-            ++m_missedNotifications;
+            m_missedNotifications += count;
             m_mutex.leave();
         }
         else
         {
-            ++m_notifications;
+            // Notifications up to the threshold activate the input, the remaining ones are missed notifications for
+            // the next activation, like they are counted by single notifications.
+            unsigned int needed = m_activationThreshold - m_notifications;
+            if (count > needed)
+            {
+                m_missedNotifications += count - needed;
+                m_notifications += needed;
+            }
+            else
+            {
+                m_notifications += count;
+            }
             m_mutex.leave();
-            if (parent.isActivated())
+            if (isActivated())
             {
                 // Activation is reached, try to activate the task
                 m_task->activate();
@@ -255,8 +279,8 @@ Tasking::InputImpl::notifyInput(void)
     else
     {
         // Not synchronized
-        ++m_notifications;
-        if (parent.isActivated())
+        m_notifications += count;
+        if (isActivated())
         {
             // Activation is reached, try to activate the task
             m_task->activate();
@@ -264,14 +288,67 @@ Tasking::InputImpl::notifyInput(void)
     }
 }
 
+// ====================================
+
+Tasking::InputImpl::InputImpl(Tasking::Input& api) :
+    parent(api), m_channel(nullptr), m_state(&m_ownState), channelNextInput(nullptr)
+{
+}
+
+//-------------------------------------
+
+Tasking::Channel*
+Tasking::InputImpl::getChannel(void) const
+{
+    return m_channel;
+}
+
+//-------------------------------------
+
+void
+Tasking::InputImpl::notifyInput(void)
+{
+    m_state->notify(1u);
+}
+
+//-------------------------------------
+
+void
+Tasking::InputImpl::notifyInput(unsigned int count)
+{
+    m_state->notify(count);
+}
+
+//-------------------------------------
+
+void
+Tasking::InputImpl::freeze(Tasking::InputState& frozenState)
+{
+    frozenState.assign(*m_state);
+    m_state = &frozenState;
+}
+
+//-------------------------------------
+
+void
+Tasking::InputImpl::thaw(void)
+{
+    if (m_state != &m_ownState)
+    {
+        m_ownState.assign(*m_state);
+        m_state = &m_ownState;
+    }
+}
+
 //-------------------------------------
 
 void
 Tasking::Input::synchronizeStart(void)
 {
+    InputState& state = *impl.m_state;
     if (impl.m_channel != nullptr)
     {
-        TaskingAccessor().synchronizeStart(*impl.m_channel, &impl.m_task->parent, impl.m_notifications);
+        TaskingAccessor().synchronizeStart(*impl.m_channel, &state.m_task->parent, state.m_notifications);
     }
 }
 
@@ -282,6 +359,6 @@ Tasking::Input::synchronizeEnd(void)
 {
     if (impl.m_channel != nullptr)
     {
-        TaskingAccessor().synchronizeEnd(*impl.m_channel, &impl.m_task->parent);
+        TaskingAccessor().synchronizeEnd(*impl.m_channel, &impl.m_state->m_task->parent);
     }
 }
@@ -32,8 +32,49 @@ Tasking::PeriodicSchedule::add(Tasking::PeriodicScheduleTrigger& newTrigger)
 
 // ==========================
 
+Tasking::PeriodicScheduleTable::PeriodicScheduleTable(Tasking::PeriodicScheduleTableEntry* entries,
+                                                      unsigned int numberOfEntries)
+{
+    schedule.impl.table = entries;
+    schedule.impl.tableCapacity = numberOfEntries;
+}
+
+//---------------------------
+
+bool
+Tasking::PeriodicScheduleTable::add(Tasking::Time period, const Tasking::PeriodicSchedule& source)
+{
+    return schedule.impl.compileIn(period, source.impl);
+}
+
+//---------------------------
+
+Tasking::Time
+Tasking::PeriodicScheduleTable::getHyperperiod(void) const
+{
+    return schedule.impl.hyperperiod_ms;
+}
+
+//---------------------------
+
+unsigned int
+Tasking::PeriodicScheduleTable::getNumberOfEntries(void) const
+{
+    return schedule.impl.tableSize;
+}
+
+// ==========================
+
 Tasking::PeriodicScheduleImpl::PeriodicScheduleImpl(void) :
-    triggers(nullptr), activeTrigger(nullptr), startTimeOffPeriod_ms(0u), period_ms(0u)
+    triggers(nullptr),
+    activeTrigger(nullptr),
+    startTimeOffPeriod_ms(0u),
+    period_ms(0u),
+    table(nullptr),
+    tableCapacity(0u),
+    tableSize(0u),
+    activeEntry(0u),
+    hyperperiod_ms(0u)
 {
 }
 
@@ -74,15 +115,130 @@ Tasking::PeriodicScheduleImpl::sortIn(Tasking::PeriodicScheduleTrigger& trigger)
 
 //---------------------------
 
+bool
+Tasking::PeriodicScheduleImpl::compileIn(Tasking::Time period, const Tasking::PeriodicScheduleImpl& schedule)
+{
+    // Only a list of triggers can be compiled into a table
+    if ((nullptr == table) || (nullptr != schedule.table) || (0u == period))
+    {
+        return false;
+    }
+
+    // New hyperperiod is the least common multiple of the current hyperperiod and the period
+    Time newHyperperiod = period;
+    if (0u != hyperperiod_ms)
+    {
+        Time a = hyperperiod_ms;
+        Time b = period;
+        while (0u != b)
+        {
+            Time remainder = a % b;
+            a = b;
+            b = remainder;
+        }
+        Time factor = hyperperiod_ms / a;
+        if (factor > (endOfTime / period))
+        {
+            return false;
+        }
+        newHyperperiod = factor * period;
+    }
+
+    // Check the needed space before the table is changed
+    Time triggersInPeriod = 0u;
+    for (const PeriodicScheduleTrigger* trigger = schedule.triggers; nullptr != trigger; trigger = trigger->next)
+    {
+        if (trigger->offsetTime < period)
+        {
+            triggersInPeriod++;
+        }
+    }
+    const Time repetitions = (0u != hyperperiod_ms) ? (newHyperperiod / hyperperiod_ms) : 1u;
+    const Time periodsOfSchedule = newHyperperiod / period;
+    if (((tableSize * repetitions) > tableCapacity)
+        || ((triggersInPeriod * periodsOfSchedule) > (tableCapacity - tableSize * repetitions)))
+    {
+        return false;
+    }
+
+    // Repeat the current table entries until the new hyperperiod is filled. The order by offset is kept.
+    const unsigned int entriesOfHyperperiod = tableSize;
+    for (Time repetition = 1u; repetition < repetitions; ++repetition)
+    {
+        for (unsigned int i = 0u; i < entriesOfHyperperiod; ++i)
+        {
+            table[tableSize].offset = table[i].offset + repetition * hyperperiod_ms;
+            table[tableSize].trigger = table[i].trigger;
+            ++tableSize;
+        }
+    }
+
+    // Sort in the triggers of each period of the schedule behind entries with the same offset
+    for (Time periodStart = 0u; periodStart < newHyperperiod; periodStart += period)
+    {
+        for (PeriodicScheduleTrigger* trigger = schedule.triggers; nullptr != trigger; trigger = trigger->next)
+        {
+            if (trigger->offsetTime < period)
+            {
+                Time offset = periodStart + trigger->offsetTime;
+                unsigned int position = tableSize;
+                while ((position > 0u) && (table[position - 1u].offset > offset))
+                {
+                    table[position] = table[position - 1u];
+                    --position;
+                }
+                table[position].offset = offset;
+                table[position].trigger = trigger;
+                ++tableSize;
+            }
+        }
+    }
+    hyperperiod_ms = newHyperperiod;
+    activeEntry = tableSize;
+    return true;
+}
+
+//---------------------------
+
+bool
+Tasking::PeriodicScheduleImpl::isEmpty(void) const
+{
+    return (nullptr == table) ? (nullptr == triggers) : (0u == tableSize);
+}
+
+//---------------------------
+
+void
+Tasking::PeriodicScheduleImpl::rewind(void)
+{
+    activeTrigger = nullptr;
+    activeEntry = tableSize;
+}
+
+//---------------------------
+
 void
 Tasking::PeriodicScheduleImpl::pushTriggers(void)
 {
-    // Fire the active trigger and all following with same offset time
-    activeTrigger->push();
-    while ((nullptr != activeTrigger->next) && (activeTrigger->offsetTime == activeTrigger->next->offsetTime))
+    if (nullptr != table)
+    {
+        // Fire all entries of the active slot of the table
+        table[activeEntry].trigger->push();
+        while (((activeEntry + 1u) < tableSize) && (table[activeEntry].offset == table[activeEntry + 1u].offset))
+        {
+            ++activeEntry;
+            table[activeEntry].trigger->push();
+        }
+    }
+    else
     {
-        activeTrigger = activeTrigger->next;
+        // Fire the active trigger and all following with same offset time
         activeTrigger->push();
+        while ((nullptr != activeTrigger->next) && (activeTrigger->offsetTime == activeTrigger->next->offsetTime))
+        {
+            activeTrigger = activeTrigger->next;
+            activeTrigger->push();
+        }
     }
 }
 
@@ -93,19 +249,37 @@ Tasking::PeriodicScheduleImpl::stepToNextTriggerOffset(void)
 {
     // For safety assume first no trigger is available
     Tasking::Time nextAbsoluteStartTime(endOfTime);
-    // Step to next trigger in list
-    if (nullptr != activeTrigger)
+    if (nullptr != table)
     {
-        activeTrigger = activeTrigger->next;
+        // Step to the next slot of the table or start the table again with the next hyperperiod
+        if (activeEntry < tableSize)
+        {
+            ++activeEntry;
+        }
+        if (activeEntry >= tableSize)
+        {
+            activeEntry = 0u;
+            startTimeOffPeriod_ms += period_ms;
+        }
+        nextAbsoluteStartTime = startTimeOffPeriod_ms + table[activeEntry].offset;
     }
-    // Check for end of list or first run after starting the schedule
-    if (nullptr == activeTrigger)
+    else
     {
-        // Start the list and update start time of period
-        activeTrigger = triggers;
-        startTimeOffPeriod_ms += period_ms;
+        // Step to next trigger in list
+        if (nullptr != activeTrigger)
+        {
+            activeTrigger = activeTrigger->next;
+        }
+        // Check for end of list or first run after starting the schedule
+        if (nullptr == activeTrigger)
+        {
+            // Start the list and update start time of period
+            activeTrigger = triggers;
+            startTimeOffPeriod_ms += period_ms;
+        }
+        // Active trigger should here always valid. If triggers is a null pointer, the schedule is not started by the
+        // event
+        nextAbsoluteStartTime = startTimeOffPeriod_ms + activeTrigger->offsetTime;
     }
-    // Active trigger should here always valid. If triggers is a null pointer, the schedule is not started by the event
-    nextAbsoluteStartTime = startTimeOffPeriod_ms + activeTrigger->offsetTime;
     return nextAbsoluteStartTime;
 }
@@ -0,0 +1,314 @@
+/*
+ * testChannelLog.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The channel log is only available for the linux platform
+#ifndef IS_NONE_PLATFORM
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <fcntl.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+
+#include <channelLog.h>
+#include <channels/fifo.h>
+#include <channels/signalChannel.h>
+#include <channels/spscRing.h>
+#include <schedulePolicyFifo.h>
+#include <schedulerUnitTest.h>
+#include <task.h>
+
+class TestChannelLog : public ::testing::Test
+{
+public:
+    typedef Tasking::Fifo<unsigned int, 8u> Channel;
+
+    /// Task popping all values from its channel
+    class ReceiveTask : public Tasking::TaskProvider<1u, Tasking::SchedulePolicyFifo>
+    {
+    public:
+        ReceiveTask(Tasking::Scheduler& scheduler) : TaskProvider(scheduler), executions(0u), sum(0u)
+        {
+            inputs[0].configure(1u);
+        }
+
+        void
+        execute(void) override
+        {
+            Channel* channel = getChannel<Channel>(0u);
+            executions++;
+            for (unsigned int* value = channel->pop(); value != nullptr; value = channel->pop())
+            {
+                sum = (sum * 10u) + *value;
+                channel->release(value);
+            }
+        }
+
+        unsigned int executions;
+        unsigned int sum;
+    };
+
+    /// Handler pushing the replayed values into the channel of the task
+    class Handler : public Tasking::ChannelReplayer::Handler
+    {
+    public:
+        Handler(Channel& p_channel, Tasking::ChannelId p_channelId) :
+            channel(p_channel), channelId(p_channelId), signals(0u)
+        {
+        }
+
+        void
+        replay(Tasking::ChannelId recordedId, const void* data, size_t size) override
+        {
+            if ((recordedId == channelId) && (size == sizeof(unsigned int)))
+            {
+                channel.push(*static_cast<const unsigned int*>(data));
+            }
+            else if ((data == nullptr) && (size == 0u))
+            {
+                signals++;
+            }
+        }
+
+        Channel& channel;
+        Tasking::ChannelId channelId;
+        unsigned int signals;
+    };
+
+    TestChannelLog(void) : scheduler(policy), task(scheduler)
+    {
+        char name[] = "/tmp/taskingChannelLogXXXXXX";
+        int fd = mkstemp(name);
+        close(fd);
+        fileName = name;
+        task.configureInput(0u, replayed);
+    }
+
+    ~TestChannelLog(void)
+    {
+        unlink(fileName.c_str());
+    }
+
+    std::string fileName;
+    Tasking::SchedulePolicyFifo policy;
+    Tasking::SchedulerUnitTest scheduler;
+    ReceiveTask task;
+    Channel replayed;
+};
+
+TEST_F(TestChannelLog, RecordAndReplay)
+{
+    Channel recorded;
+    Tasking::SignalChannel signal;
+    {
+        Tasking::ChannelRecorder recorder(fileName.c_str(), 2u, 4096u);
+        ASSERT_TRUE(recorder.isValid());
+        recorded.setTap(&recorder);
+        signal.setTap(&recorder);
+        EXPECT_TRUE(recorded.push(1u));
+        signal.trigger();
+        EXPECT_TRUE(recorded.push(2u));
+        const unsigned int batch[] = {3u, 4u};
+        EXPECT_EQ(2u, recorded.pushBatch(batch, 2u));
+        EXPECT_EQ(5u, recorder.getNumberOfRecords());
+        EXPECT_EQ(0u, recorder.getNumberOfLostRecords());
+        recorded.setTap(nullptr);
+        signal.setTap(nullptr);
+    }
+
+    Tasking::ChannelReplayer replayer(fileName.c_str());
+    ASSERT_TRUE(replayer.isValid());
+    Handler handler(replayed, recorded.getChannelId());
+    scheduler.start();
+    EXPECT_EQ(5u, replayer.replay(handler, scheduler, false));
+    EXPECT_EQ(4u, task.executions);
+    EXPECT_EQ(1234u, task.sum);
+    EXPECT_EQ(1u, handler.signals);
+
+    // A second replay starts again at the beginning
+    EXPECT_EQ(5u, replayer.replay(handler, false));
+    scheduler.schedule();
+    EXPECT_EQ(12341234u, task.sum);
+}
+
+TEST_F(TestChannelLog, SegmentPerThread)
+{
+    Channel recorded;
+    Tasking::ChannelRecorder recorder(fileName.c_str(), 2u, 4096u);
+    ASSERT_TRUE(recorder.isValid());
+    recorded.setTap(&recorder);
+
+    // Each thread records into its own segment, a third thread finds no segment
+    for (unsigned int value = 1u; value <= 3u; ++value)
+    {
+        std::thread producer([&recorded, value]() {
+            recorded.push(value);
+            recorded.release(recorded.pop());
+        });
+        producer.join();
+    }
+    EXPECT_EQ(2u, recorder.getNumberOfRecords());
+    EXPECT_EQ(1u, recorder.getNumberOfLostRecords());
+}
+
+TEST_F(TestChannelLog, ManyRecordersInOneThread)
+{
+    static const unsigned int numberOfRecorders = 6u;
+    Channel recorded;
+    std::unique_ptr<Tasking::ChannelRecorder> recorders[numberOfRecorders];
+    for (unsigned int i = 0u; i < numberOfRecorders; ++i)
+    {
+        recorders[i].reset(new Tasking::ChannelRecorder((fileName + std::to_string(i)).c_str(), 1u, 4096u));
+        ASSERT_TRUE(recorders[i]->isValid());
+    }
+
+    // The thread keeps its segment in each recorder, even when it alternates between the recorders
+    for (unsigned int round = 0u; round < 3u; ++round)
+    {
+        for (unsigned int i = 0u; i < numberOfRecorders; ++i)
+        {
+            recorded.setTap(recorders[i].get());
+            recorded.push(i);
+            recorded.release(recorded.pop());
+        }
+    }
+    recorded.setTap(nullptr);
+    for (unsigned int i = 0u; i < numberOfRecorders; ++i)
+    {
+        EXPECT_EQ(3u, recorders[i]->getNumberOfRecords());
+        EXPECT_EQ(0u, recorders[i]->getNumberOfLostRecords());
+        recorders[i].reset();
+        unlink((fileName + std::to_string(i)).c_str());
+    }
+}
+
+TEST_F(TestChannelLog, RecordRingData)
+{
+    Tasking::SpscRing<unsigned int, 8u> recorded;
+    {
+        Tasking::ChannelRecorder recorder(fileName.c_str(), 1u, 4096u);
+        recorded.setTap(&recorder);
+        EXPECT_TRUE(recorded.push(5u));
+        EXPECT_TRUE(recorded.push(6u));
+        recorded.setTap(nullptr);
+    }
+
+    // The data of the ring is replayed
+    Tasking::ChannelReplayer replayer(fileName.c_str());
+    Handler handler(replayed, recorded.getChannelId());
+    scheduler.start();
+    EXPECT_EQ(2u, replayer.replay(handler, scheduler, false));
+    EXPECT_EQ(56u, task.sum);
+}
+
+TEST_F(TestChannelLog, CorruptLog)
+{
+    Channel recorded;
+    {
+        Tasking::ChannelRecorder recorder(fileName.c_str(), 1u, 4096u);
+        recorded.setTap(&recorder);
+        for (unsigned int value = 1u; value <= 3u; ++value)
+        {
+            recorded.push(value);
+            recorded.release(recorded.pop());
+        }
+        recorded.setTap(nullptr);
+    }
+    Handler handler(replayed, recorded.getChannelId());
+
+    // The segment starts after the file header of 64 bytes, its records after the segment header of 64 bytes. Each
+    // record has 24 bytes, the size of the data is at offset 12. A size beyond the used space ends the segment.
+    int fd = open(fileName.c_str(), O_RDWR);
+    ASSERT_LE(0, fd);
+    uint32_t size = 0xffffffffu;
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(size)), pwrite(fd, &size, sizeof(size), 128 + 24 + 12));
+    {
+        Tasking::ChannelReplayer replayer(fileName.c_str());
+        ASSERT_TRUE(replayer.isValid());
+        EXPECT_EQ(1u, replayer.replay(handler, false));
+    }
+
+    // A used space beyond the segment ends the segment at once
+    uint64_t used = 0xffffffffffffu;
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(used)), pwrite(fd, &used, sizeof(used), 64));
+    {
+        Tasking::ChannelReplayer replayer(fileName.c_str());
+        ASSERT_TRUE(replayer.isValid());
+        EXPECT_EQ(0u, replayer.replay(handler, false));
+    }
+
+    // A log truncated in the segments is not replayed
+    EXPECT_EQ(0, ftruncate(fd, 128));
+    {
+        Tasking::ChannelReplayer replayer(fileName.c_str());
+        EXPECT_FALSE(replayer.isValid());
+    }
+    close(fd);
+}
+
+TEST_F(TestChannelLog, FullSegment)
+{
+    Channel recorded;
+    Tasking::ChannelRecorder recorder(fileName.c_str(), 1u, 64u);
+    ASSERT_TRUE(recorder.isValid());
+    recorded.setTap(&recorder);
+
+    // A record of an unsigned int needs 24 bytes
+    for (unsigned int value = 1u; value <= 3u; ++value)
+    {
+        EXPECT_TRUE(recorded.push(value));
+        recorded.release(recorded.pop());
+    }
+    EXPECT_EQ(2u, recorder.getNumberOfRecords());
+    EXPECT_EQ(1u, recorder.getNumberOfLostRecords());
+}
+
+TEST_F(TestChannelLog, PacedReplay)
+{
+    Channel recorded;
+    {
+        Tasking::ChannelRecorder recorder(fileName.c_str(), 1u, 4096u);
+        recorded.setTap(&recorder);
+        recorded.push(1u);
+        struct timespec pause = {0, 20000000};
+        nanosleep(&pause, nullptr);
+        recorded.push(2u);
+        recorded.setTap(nullptr);
+    }
+
+    // The clock of the scheduler is stepped by the time between the records
+    Tasking::ChannelReplayer replayer(fileName.c_str());
+    Handler handler(replayed, recorded.getChannelId());
+    scheduler.start();
+    EXPECT_EQ(2u, replayer.replay(handler, scheduler, true));
+    EXPECT_EQ(12u, task.sum);
+    EXPECT_LE(Tasking::fromNanoseconds(20000000u), scheduler.getTime());
+}
+
+TEST_F(TestChannelLog, InvalidFile)
+{
+    Tasking::ChannelReplayer replayer(fileName.c_str());
+    EXPECT_FALSE(replayer.isValid());
+    Handler handler(replayed, 0u);
+    EXPECT_EQ(0u, replayer.replay(handler, false));
+}
+
+#endif
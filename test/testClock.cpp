@@ -92,7 +92,11 @@ public:
         using Tasking::Clock::enqueueHead;
         using Tasking::Clock::getHeadTime;
         using Tasking::Clock::getNextStartTime;
+        using Tasking::Clock::isPending;
         using Tasking::Clock::readFirstPending;
+        using Tasking::Clock::reportWakeUp;
+        using Tasking::Clock::startAllAt;
+        using Tasking::Clock::takeAllPending;
         using Tasking::Clock::startAt;
         using Tasking::Clock::startIn;
         Tasking::Time now;
@@ -187,6 +191,21 @@ TEST_F(TestClock, EnqueueHeadRunningCondition)
     EXPECT_TRUE(&event1.impl == clock.readFirstPending());
 }
 
+TEST_F(TestClock, isPendingWithTime)
+{
+    // The time is not requested for an empty queue
+    Tasking::Time currentTime = 7u;
+    EXPECT_FALSE(clock.isPending(currentTime));
+    EXPECT_EQ(7u, currentTime);
+    TestEvent event2(scheduler, 2u);
+    clock.enqueue(clock.getTime(), event2.impl);
+    clock.now = 1u;
+    EXPECT_FALSE(clock.isPending(currentTime));
+    clock.now = 3u;
+    EXPECT_TRUE(clock.isPending(currentTime));
+    EXPECT_EQ(3u, currentTime);
+}
+
 TEST_F(TestClock, EnqueueByTimeOneElement)
 {
     TestEvent event1(scheduler, 1u);
@@ -568,3 +587,144 @@ TEST_F(TestClock, StartInAfterEmptyEnqueueHead)
     EXPECT_TRUE(&event2.impl == clock.readFirstPending());
     EXPECT_TRUE(nullptr == clock.readFirstPending());
 }
+
+TEST_F(TestClock, getStartTimeWithSlack)
+{
+    // Wake up is delayed to the end of the slack when no other event is in the window
+    Tasking::Event event5(scheduler);
+    event5.setSlack(3u);
+    event5.trigger(5u); // Window 5 to 8
+    EXPECT_EQ(8u, clock.getNextStartTime());
+    // An event inside the window with a shorter slack brings the wake up forward
+    Tasking::Event event6(scheduler);
+    event6.trigger(6u); // Window 6 to 6
+    EXPECT_EQ(6u, clock.getNextStartTime());
+    // An event after the window has no effect
+    Tasking::Event event7(scheduler);
+    event7.trigger(7u);
+    EXPECT_EQ(6u, clock.getNextStartTime());
+    // At the wake up both events of the window are pending, but the event after is not
+    clock.now = 6u;
+    EXPECT_TRUE(&event5 == &(clock.readFirstPending()->parent));
+    EXPECT_TRUE(&event6 == &(clock.readFirstPending()->parent));
+    EXPECT_TRUE(nullptr == clock.readFirstPending());
+    EXPECT_EQ(7u, clock.getNextStartTime());
+}
+
+TEST_F(TestClock, startTimerWithSlack)
+{
+    // Timer is started at the end of the slack
+    Tasking::Event event2(scheduler);
+    event2.setSlack(3u);
+    event2.trigger(2u);
+    EXPECT_EQ(5u, clock.waitingTime);
+    // An earlier end of a window inside the slack adjusts the timer
+    Tasking::Event event1(scheduler);
+    event1.setSlack(3u);
+    event1.trigger(1u);
+    EXPECT_EQ(4u, clock.waitingTime);
+}
+
+TEST_F(TestClock, startTimerBehindEventWithSlack)
+{
+    Tasking::Event event5(scheduler);
+    event5.setSlack(10u);
+    event5.trigger(5u); // Window 5 to 15
+    EXPECT_EQ(15u, clock.waitingTime);
+    // A later event without slack inside the window brings the timer forward
+    Tasking::Event event7(scheduler);
+    event7.trigger(7u);
+    EXPECT_EQ(7u, clock.getNextStartTime());
+    EXPECT_EQ(7u, clock.waitingTime);
+    // A later event with a window ending after the wake up keeps the timer
+    clock.waitingTime = 0u;
+    Tasking::Event event6(scheduler);
+    event6.setSlack(2u);
+    event6.trigger(6u); // Window 6 to 8
+    EXPECT_EQ(0u, clock.waitingTime);
+    EXPECT_EQ(7u, clock.getNextStartTime());
+}
+
+TEST_F(TestClock, statistic)
+{
+    Tasking::Clock::Statistic statistic;
+    Tasking::Event event1(scheduler);
+    Tasking::Event event2(scheduler);
+    event1.trigger(1u);
+    event2.trigger(1u);
+    clock.now = 1u;
+    clock.reportWakeUp();
+    EXPECT_TRUE(nullptr != clock.readFirstPending());
+    EXPECT_TRUE(nullptr != clock.readFirstPending());
+    EXPECT_TRUE(nullptr == clock.readFirstPending());
+    scheduler.readClockStatistic(statistic);
+    EXPECT_EQ(1u, statistic.wakeUps);
+    EXPECT_EQ(2u, statistic.firedEvents);
+    // Read out has cleared the counters
+    scheduler.readClockStatistic(statistic);
+    EXPECT_EQ(0u, statistic.wakeUps);
+    EXPECT_EQ(0u, statistic.firedEvents);
+}
+
+TEST_F(TestClock, takeAllPending)
+{
+    // Three events at time point 1, 3, and 5
+    prepareFilledQueue();
+    EXPECT_TRUE(nullptr == clock.takeAllPending(0u));
+    // All events up to time point 3 are taken in the order of the queue
+    Tasking::EventImpl* batch = clock.takeAllPending(4u);
+    for (int i = 0; i < 6; ++i)
+    {
+        ASSERT_TRUE(&events[i]->impl == batch);
+        EXPECT_FALSE(events[i]->impl.queued);
+        batch = batch->nextPending;
+    }
+    EXPECT_TRUE(nullptr == batch);
+    // Remaining events are still in the queue with a correct head block
+    EXPECT_EQ(5u, clock.getHeadTime());
+    EXPECT_TRUE(nullptr == events[7]->getPrevious());
+    EXPECT_TRUE(nullptr == clock.takeAllPending(4u));
+    // A new event before the remaining ones becomes the new head
+    TestEvent event2(scheduler, 2u);
+    clock.enqueue(4u, event2.impl);
+    EXPECT_TRUE(&event2.impl == events[6]->getPrevious());
+    batch = clock.takeAllPending(5u);
+    ASSERT_TRUE(&event2.impl == batch);
+    EXPECT_TRUE(&events[6]->impl == batch->nextPending);
+    EXPECT_TRUE(clock.isEmtpy());
+    EXPECT_EQ(0u, clock.getHeadTime());
+}
+
+TEST_F(TestClock, startAllAt)
+{
+    TestEvent periodic(scheduler, 2u);
+    TestEvent single(scheduler, 2u);
+    TestEvent late(scheduler, 0u);
+    periodic.impl.periodical = true;
+    late.impl.periodical = true;
+    periodic.impl.nextPending = &single.impl;
+    single.impl.nextPending = &late.impl;
+    clock.startAllAt(&periodic.impl, clock.now);
+    // Only periodic events are queued, an event in the past is pending and signaled
+    EXPECT_TRUE(periodic.impl.queued);
+    EXPECT_FALSE(single.impl.queued);
+    EXPECT_EQ(1, scheduler.signalCount);
+    EXPECT_EQ(2u, clock.waitingTime);
+    EXPECT_TRUE(&late.impl == clock.readFirstPending());
+    EXPECT_TRUE(nullptr == clock.readFirstPending());
+    clock.now = 2u;
+    EXPECT_TRUE(&periodic.impl == clock.readFirstPending());
+}
+
+TEST(TimeResolution, Conversion)
+{
+    // Conversions are consistent for each selected time resolution
+    EXPECT_EQ(Tasking::ticksPerSecond, Tasking::fromSeconds(1u));
+    EXPECT_EQ(Tasking::fromSeconds(1u), Tasking::fromMilliseconds(1000u));
+    EXPECT_EQ(Tasking::fromMilliseconds(1u), Tasking::fromMicroseconds(1000u));
+    EXPECT_EQ(Tasking::fromMicroseconds(1000u), Tasking::fromNanoseconds(1000000u));
+    EXPECT_EQ(1000000000u, Tasking::toNanoseconds(Tasking::fromSeconds(1u)));
+    EXPECT_EQ(250000000u, Tasking::toNanoseconds(Tasking::fromMilliseconds(250u)));
+    // A year in nanoseconds is still in the time range
+    EXPECT_LT(Tasking::fromSeconds(60u * 60u * 24u * 365u), Tasking::endOfTime / 500u);
+}
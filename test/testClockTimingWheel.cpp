@@ -0,0 +1,305 @@
+/*
+ * testTaskEvent.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <impl/clock_impl.h>
+#include <gtest/gtest.h>
+#include <clockTimingWheel.h>
+#include <schedulePolicyLifo.h>
+#include <schedulerUnitTest.h>
+#include <scheduler.h>
+#include <taskEvent.h>
+
+class TestClockTimingWheel : public ::testing::Test
+{
+public:
+    class TestScheduler : public Tasking::Scheduler
+    {
+    public:
+        TestScheduler(Tasking::SchedulePolicy& schedulePolicy, Tasking::Clock& pClock) :
+            Scheduler(schedulePolicy, pClock)
+        {
+        }
+        virtual void
+        signal(void)
+        {
+        }
+        virtual void
+        waitUntilEmpty(void)
+        {
+        }
+        virtual void setZeroTime(Tasking::Time)
+        {
+        }
+    };
+
+    /// Test event to access protected data of the event.
+    class TestEvent : public Tasking::Event
+    {
+    public:
+        // Mockup implementation, which is in normal case private part of event and not accessible
+        Tasking::EventImpl impl;
+        TestEvent(Tasking::Scheduler& scheduler) : Event(scheduler), impl(*this, scheduler)
+        {
+        }
+    };
+
+    /// Clock with a manual time
+    class ClockImplementation : public Tasking::Clock
+    {
+    public:
+        ClockImplementation(Tasking::Scheduler& p_scheduler) : Clock(p_scheduler), now(0u), waitingTime(0u)
+        {
+        }
+        virtual Tasking::Time
+        getTime(void) const
+        {
+            return now;
+        }
+        virtual void
+        startTimer(Tasking::Time timeSpan)
+        {
+            waitingTime = timeSpan;
+        }
+        Tasking::Time now;
+        Tasking::Time waitingTime;
+    };
+
+    static const unsigned int numberOfEvents = 200u;
+
+    Tasking::SchedulePolicyLifo policy;
+    TestScheduler scheduler;
+    ClockImplementation clock;
+    TestEvent* events[numberOfEvents];
+    unsigned int seed;
+
+    TestClockTimingWheel(void) : scheduler(policy, clock), clock(scheduler), seed(42u)
+    {
+        for (unsigned int i = 0; i < numberOfEvents; ++i)
+        {
+            events[i] = new TestEvent(scheduler);
+        }
+    }
+
+    ~TestClockTimingWheel(void)
+    {
+        for (unsigned int i = 0; i < numberOfEvents; ++i)
+        {
+            delete events[i];
+        }
+    }
+
+    /// Simple linear congruential generator for reproducible times
+    unsigned int
+    random(void)
+    {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 8u);
+    }
+
+    /// Read all pending events and check that they are in order of activation
+    unsigned int
+    readPending(Tasking::Time& lastTime)
+    {
+        unsigned int count = 0u;
+        for (Tasking::EventImpl* event = clock.readFirstPending(); event != nullptr; event = clock.readFirstPending())
+        {
+            EXPECT_LE(event->nextActivation_ms, clock.now);
+            EXPECT_LE(lastTime, event->nextActivation_ms);
+            lastTime = event->nextActivation_ms;
+            ++count;
+        }
+        return count;
+    }
+};
+
+TEST_F(TestClockTimingWheel, EmptyWheel)
+{
+    Tasking::ClockTimingWheel wheel(scheduler);
+    EXPECT_TRUE(clock.isEmtpy());
+    EXPECT_FALSE(clock.isPending());
+    EXPECT_EQ(0u, clock.getNextStartTime());
+    EXPECT_EQ(0u, clock.getHeadTime());
+    clock.now = 1000000000u;
+    EXPECT_TRUE((clock.readFirstPending() == nullptr));
+    EXPECT_EQ(0u, clock.getNextStartTime());
+}
+
+TEST_F(TestClockTimingWheel, NextStartTimeOnAllLevels)
+{
+    Tasking::ClockTimingWheel wheel(scheduler);
+    const Tasking::Time times[] = {5000000000u, 300000u, 5000u, 70u, 3u};
+    for (unsigned int i = 0; i < 5u; ++i)
+    {
+        clock.startAt(events[i]->impl, times[i]);
+        EXPECT_EQ(times[i], clock.getNextStartTime());
+        EXPECT_EQ(times[i], clock.waitingTime);
+    }
+    EXPECT_EQ(3u, clock.getHeadTime());
+    for (unsigned int i = 5u; i > 0u; --i)
+    {
+        clock.now = times[i - 1u] - 1u;
+        EXPECT_FALSE(clock.isPending());
+        EXPECT_EQ(times[i - 1u], clock.getNextStartTime());
+        clock.now = times[i - 1u];
+        EXPECT_TRUE(clock.isPending());
+        EXPECT_TRUE((clock.readFirstPending() == &events[i - 1u]->impl));
+        EXPECT_FALSE(events[i - 1u]->impl.queued);
+    }
+    EXPECT_TRUE(clock.isEmtpy());
+}
+
+TEST_F(TestClockTimingWheel, SameTimeInOrderOfStart)
+{
+    Tasking::ClockTimingWheel wheel(scheduler);
+    for (unsigned int i = 0; i < 4u; ++i)
+    {
+        clock.startAt(events[i]->impl, 100u);
+    }
+    clock.now = 200u;
+    for (unsigned int i = 0; i < 4u; ++i)
+    {
+        EXPECT_TRUE((clock.readFirstPending() == &events[i]->impl));
+    }
+}
+
+TEST_F(TestClockTimingWheel, StartInImmediate)
+{
+    Tasking::ClockTimingWheel wheel(scheduler);
+    clock.now = 10u;
+    clock.startIn(events[0]->impl, 5u);
+    clock.startIn(events[1]->impl, 0u);
+    EXPECT_TRUE(clock.isPending());
+    EXPECT_TRUE((clock.readFirstPending() == &events[1]->impl));
+    EXPECT_TRUE((clock.readFirstPending() == nullptr));
+    EXPECT_EQ(15u, clock.getNextStartTime());
+}
+
+TEST_F(TestClockTimingWheel, Cancel)
+{
+    Tasking::ClockTimingWheel wheel(scheduler);
+    clock.startAt(events[0]->impl, 10u);
+    clock.startAt(events[1]->impl, 100u);
+    clock.startAt(events[2]->impl, 100000u);
+    EXPECT_EQ(10u, clock.getNextStartTime());
+    clock.dequeue(events[0]->impl);
+    EXPECT_FALSE(events[0]->impl.queued);
+    EXPECT_EQ(100u, clock.getNextStartTime());
+    clock.dequeue(events[2]->impl);
+    clock.dequeue(events[2]->impl); // Second dequeue has no effect
+    clock.now = 1000000u;
+    EXPECT_TRUE((clock.readFirstPending() == &events[1]->impl));
+    EXPECT_TRUE((clock.readFirstPending() == nullptr));
+    clock.startAt(events[0]->impl, 2000000u);
+    clock.dequeueAll();
+    EXPECT_TRUE(clock.isEmtpy());
+    EXPECT_FALSE(events[0]->impl.queued);
+}
+
+TEST_F(TestClockTimingWheel, RandomTimesInOrder)
+{
+    Tasking::ClockTimingWheel wheel(scheduler);
+    // Random start and stop of events while the time moves in random steps
+    Tasking::Time lastTime = 0u;
+    unsigned int started = 0u;
+    unsigned int stopped = 0u;
+    unsigned int fired = 0u;
+    for (unsigned int round = 0u; round < 2000u; ++round)
+    {
+        TestEvent& event = *events[random() % numberOfEvents];
+        if (event.impl.queued)
+        {
+            clock.dequeue(event.impl);
+            ++stopped;
+        }
+        else
+        {
+            Tasking::Time span = random() % ((random() % 2u) ? 100u : 1000000u);
+            clock.startAt(event.impl, clock.now + 1u + span);
+            ++started;
+        }
+        // Next start time is the earliest future activation
+        Tasking::Time expected = 0u;
+        for (unsigned int i = 0; i < numberOfEvents; ++i)
+        {
+            if (events[i]->impl.queued && ((expected == 0u) || (events[i]->impl.nextActivation_ms < expected)))
+            {
+                expected = events[i]->impl.nextActivation_ms;
+            }
+        }
+        EXPECT_EQ(expected, clock.getNextStartTime());
+        clock.now += random() % 5000u;
+        fired += readPending(lastTime);
+    }
+    clock.now = Tasking::endOfTime - 1u;
+    fired += readPending(lastTime);
+    EXPECT_EQ(started, stopped + fired);
+    EXPECT_TRUE(clock.isEmtpy());
+}
+
+TEST_F(TestClockTimingWheel, TakeOverQueue)
+{
+    clock.startAt(events[0]->impl, 30u);
+    clock.startAt(events[1]->impl, 10u);
+    clock.startAt(events[2]->impl, 20u);
+    {
+        Tasking::ClockTimingWheel wheel(scheduler);
+        EXPECT_EQ(10u, clock.getNextStartTime());
+        clock.now = 10u;
+        EXPECT_TRUE((clock.readFirstPending() == &events[1]->impl));
+        clock.startAt(events[3]->impl, 25u);
+    }
+    // Back in the sorted list of the clock
+    EXPECT_EQ(20u, clock.getHeadTime());
+    clock.now = 100u;
+    EXPECT_TRUE((clock.readFirstPending() == &events[2]->impl));
+    EXPECT_TRUE((clock.readFirstPending() == &events[3]->impl));
+    EXPECT_TRUE((clock.readFirstPending() == &events[0]->impl));
+    EXPECT_TRUE((clock.readFirstPending() == nullptr));
+}
+
+TEST_F(TestClockTimingWheel, PeriodicEvent)
+{
+    class CountEvent : public Tasking::Event
+    {
+    public:
+        CountEvent(Tasking::Scheduler& scheduler) : Event(scheduler), fired(0u)
+        {
+        }
+        void
+        onFire(void) override
+        {
+            ++fired;
+        }
+        unsigned int fired;
+    };
+
+    Tasking::SchedulePolicyLifo unitTestPolicy;
+    Tasking::SchedulerUnitTest unitTestScheduler(unitTestPolicy);
+    Tasking::ClockTimingWheel wheel(unitTestScheduler);
+    CountEvent event(unitTestScheduler);
+    unitTestScheduler.start();
+    event.setPeriodicTiming(100u, 50u);
+    for (unsigned int i = 0; i < 10u; ++i)
+    {
+        unitTestScheduler.schedule(49u);
+        EXPECT_EQ(i, event.fired);
+        unitTestScheduler.schedule(51u);
+        EXPECT_EQ(i + 1u, event.fired);
+    }
+    EXPECT_TRUE(event.isTriggered());
+}
@@ -0,0 +1,180 @@
+/*
+ * testFdChannel.cpp
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The reactor is only available for the linux platform
+#ifndef IS_NONE_PLATFORM
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <fdChannel.h>
+#include <reactor.h>
+#include <schedulePolicyFifo.h>
+#include <schedulerUnitTest.h>
+#include <task.h>
+
+class TestFdChannel : public ::testing::Test
+{
+public:
+    /// Task reading all available data from the channel without blocking
+    class ReadTask : public Tasking::TaskProvider<1u, Tasking::SchedulePolicyFifo>
+    {
+    public:
+        ReadTask(Tasking::Scheduler& scheduler) : TaskProvider(scheduler), executions(0u), bytes(0u), closed(false)
+        {
+            inputs[0].configure(1u);
+        }
+
+        void
+        execute(void) override
+        {
+            Tasking::FdChannel* channel = getChannel<Tasking::FdChannel>(0u);
+            executions++;
+            closed = channel->isClosed();
+            char buffer[16];
+            ssize_t received = read(channel->getFd(), buffer, sizeof(buffer));
+            while (received > 0)
+            {
+                bytes += received;
+                received = read(channel->getFd(), buffer, sizeof(buffer));
+            }
+        }
+
+        unsigned int executions;
+        unsigned int bytes;
+        bool closed;
+    };
+
+    TestFdChannel(void) : scheduler(policy), task(scheduler)
+    {
+        int state = pipe2(pipeFds, O_NONBLOCK);
+        EXPECT_EQ(0, state);
+    }
+
+    ~TestFdChannel(void)
+    {
+        close(pipeFds[0]);
+        if (pipeFds[1] >= 0)
+        {
+            close(pipeFds[1]);
+        }
+    }
+
+    /// Schedule until the task reaches a number of executions or the timeout in milliseconds is over.
+    void
+    scheduleUntil(unsigned int executions, unsigned int timeout = 1000u)
+    {
+        struct timespec sleepTime = {0, 1000000};
+        for (unsigned int i = 0u; (i < timeout) && (task.executions < executions); ++i)
+        {
+            nanosleep(&sleepTime, nullptr);
+            scheduler.schedule();
+        }
+    }
+
+    void
+    send(const char* data, size_t length)
+    {
+        ssize_t written = write(pipeFds[1], data, length);
+        EXPECT_EQ(static_cast<ssize_t>(length), written);
+    }
+
+    Tasking::SchedulePolicyFifo policy;
+    Tasking::SchedulerUnitTest scheduler;
+    Tasking::Reactor reactor;
+    ReadTask task;
+    int pipeFds[2];
+};
+
+TEST_F(TestFdChannel, ReadableActivatesTask)
+{
+    Tasking::FdChannel channel(reactor, pipeFds[0]);
+    task.configureInput(0u, channel);
+    scheduler.start();
+    EXPECT_TRUE(channel.arm());
+
+    send("abc", 3u);
+    scheduleUntil(1u);
+    EXPECT_EQ(1u, task.executions);
+    EXPECT_EQ(3u, task.bytes);
+    EXPECT_TRUE(channel.isReadable());
+    EXPECT_FALSE(channel.isWritable());
+
+    // The channel is armed again after the task is finalized
+    send("de", 2u);
+    scheduleUntil(2u);
+    EXPECT_EQ(2u, task.executions);
+    EXPECT_EQ(5u, task.bytes);
+}
+
+TEST_F(TestFdChannel, NoPushWithoutArm)
+{
+    {
+        Tasking::FdChannel channel(reactor, pipeFds[0]);
+        task.configureInput(0u, channel);
+        scheduler.start();
+
+        send("abc", 3u);
+        scheduleUntil(1u, 100u);
+        EXPECT_EQ(0u, task.executions);
+    }
+
+    // A channel is not watched after its destruction
+    Tasking::FdChannel channel(reactor, pipeFds[0]);
+    task.configureInput(0u, channel);
+    {
+        Tasking::FdChannel removed(reactor, pipeFds[0]);
+        EXPECT_TRUE(removed.arm());
+    }
+    send("de", 2u);
+    scheduleUntil(1u, 100u);
+    EXPECT_EQ(0u, task.executions);
+}
+
+TEST_F(TestFdChannel, HangUp)
+{
+    Tasking::FdChannel channel(reactor, pipeFds[0]);
+    task.configureInput(0u, channel);
+    scheduler.start();
+    EXPECT_TRUE(channel.arm());
+
+    close(pipeFds[1]);
+    pipeFds[1] = -1;
+    // A hang up persists, so the channel is pushed again after each execution
+    scheduleUntil(1u);
+    EXPECT_LE(1u, task.executions);
+    EXPECT_TRUE(task.closed);
+}
+
+TEST_F(TestFdChannel, Writable)
+{
+    Tasking::FdChannel channel(reactor, pipeFds[1], Tasking::FdChannel::writable);
+    task.configureInput(0u, channel);
+    scheduler.start();
+    EXPECT_TRUE(channel.arm());
+
+    // An empty pipe stays writable, so the channel is pushed again after each execution
+    scheduleUntil(1u);
+    EXPECT_LE(1u, task.executions);
+    EXPECT_TRUE(channel.isWritable());
+    EXPECT_FALSE(channel.isReadable());
+}
+
+#endif
@@ -198,3 +198,80 @@ TEST_F(TestPeriodicSchedule, manyTimeTriggers)
     EXPECT_EQ(1u, triggeredTask7.counter);
     EXPECT_EQ(1u, triggeredTask8.counter);
 }
+
+TEST_F(TestPeriodicSchedule, compileTableOfSchedules)
+{
+    // Schedule with period 4 ms and trigger at 1 ms, schedule with period 6 ms and triggers at 1 ms and 3 ms. The
+    // hyperperiod is 12 ms with slots at 1, 3, 5, 7 and 9 ms. Both schedules trigger at 1 ms and 9 ms.
+    Tasking::PeriodicScheduleTrigger trigger4(1u);
+    CountTask triggeredTask4(scheduler);
+    triggeredTask4.configureInput(0, trigger4);
+    periodicSchedule.add(trigger4);
+
+    Tasking::PeriodicSchedule schedule6;
+    Tasking::PeriodicScheduleTrigger trigger6a(1u);
+    CountTask triggeredTask6a(scheduler);
+    triggeredTask6a.configureInput(0, trigger6a);
+    schedule6.add(trigger6a);
+    Tasking::PeriodicScheduleTrigger trigger6b(3u);
+    CountTask triggeredTask6b(scheduler);
+    triggeredTask6b.configureInput(0, trigger6b);
+    schedule6.add(trigger6b);
+
+    Tasking::PeriodicScheduleTableProvider<7u> table;
+    ASSERT_TRUE(table.add(4u, periodicSchedule));
+    EXPECT_EQ(4u, table.getHyperperiod());
+    EXPECT_EQ(1u, table.getNumberOfEntries());
+    ASSERT_TRUE(table.add(6u, schedule6));
+    EXPECT_EQ(12u, table.getHyperperiod());
+    EXPECT_EQ(7u, table.getNumberOfEntries());
+
+    event.setPeriodicSchedule(0u, table);
+    scheduler.start(true);
+    Tasking::Clock::Statistic statistic;
+    scheduler.readClockStatistic(statistic);
+
+    scheduler.schedule(1u); // 1 ms, trigger of both schedules
+    EXPECT_EQ(1u, triggeredTask4.counter);
+    EXPECT_EQ(1u, triggeredTask6a.counter);
+    EXPECT_EQ(0u, triggeredTask6b.counter);
+    scheduler.schedule(2u); // 3 ms
+    EXPECT_EQ(1u, triggeredTask4.counter);
+    EXPECT_EQ(1u, triggeredTask6b.counter);
+    scheduler.schedule(2u); // 5 ms
+    EXPECT_EQ(2u, triggeredTask4.counter);
+    EXPECT_EQ(1u, triggeredTask6a.counter);
+    scheduler.schedule(2u); // 7 ms
+    EXPECT_EQ(2u, triggeredTask4.counter);
+    EXPECT_EQ(2u, triggeredTask6a.counter);
+    scheduler.schedule(2u); // 9 ms
+    EXPECT_EQ(3u, triggeredTask4.counter);
+    EXPECT_EQ(2u, triggeredTask6b.counter);
+    scheduler.schedule(4u); // 13 ms, next hyperperiod
+    EXPECT_EQ(4u, triggeredTask4.counter);
+    EXPECT_EQ(3u, triggeredTask6a.counter);
+    EXPECT_EQ(2u, triggeredTask6b.counter);
+
+    // One clock entry per slot: slots at 1, 3, 5, 7, 9 and 13 ms
+    scheduler.readClockStatistic(statistic);
+    EXPECT_EQ(6u, statistic.firedEvents);
+    EXPECT_EQ(0u, task.counter);
+}
+
+TEST_F(TestPeriodicSchedule, tableTooSmall)
+{
+    Tasking::PeriodicScheduleTrigger trigger2(0u);
+    periodicSchedule.add(trigger2);
+    Tasking::PeriodicSchedule schedule3;
+    Tasking::PeriodicScheduleTrigger trigger3(0u);
+    schedule3.add(trigger3);
+
+    // Hyperperiod of 6 ms needs 3 entries for period 2 ms and 2 entries for period 3 ms
+    Tasking::PeriodicScheduleTableProvider<4u> table;
+    EXPECT_FALSE(table.add(0u, periodicSchedule));
+    ASSERT_TRUE(table.add(2u, periodicSchedule));
+    EXPECT_FALSE(table.add(3u, schedule3));
+    // Table is unchanged by the failed compilation
+    EXPECT_EQ(2u, table.getHyperperiod());
+    EXPECT_EQ(1u, table.getNumberOfEntries());
+}
@@ -0,0 +1,135 @@
+/*
+ * testSchedulePolicySharded.cpp
+ *
+ * Copyright 2012-2019 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <task.h>
+#include <taskGroup.h>
+#include <schedulerUnitTest.h>
+#include <schedulePolicyFifo.h>
+#include <schedulePolicyPSlot.h>
+#include <schedulePolicySharded.h>
+
+class TestSchedulePolicySharded : public ::testing::Test
+{
+public:
+    typedef Tasking::SchedulePolicyShardedProvider<Tasking::SchedulePolicyFifo, 3u> Policy;
+
+    TestSchedulePolicySharded(void) : policy(Tasking::SchedulePolicySharded::shardByTaskId), scheduler(policy)
+    {
+    }
+
+protected:
+    class CheckTask : public Tasking::TaskProvider<1u, Policy>
+    {
+    public:
+        CheckTask(Tasking::Scheduler& scheduler, Tasking::TaskId id) :
+            TaskProvider(scheduler, id), impl(scheduler, policyData, *this, inputs)
+        {
+        }
+        CheckTask(Tasking::Scheduler& scheduler, Policy::Settings settings, Tasking::TaskId id) :
+            TaskProvider(scheduler, settings, id), impl(scheduler, policyData, *this, inputs)
+        {
+        }
+        /// Implement execute because it is necessary by default
+        void
+        execute(void)
+        {
+            // Nothing to do in this test
+        }
+        Tasking::TaskImpl impl; // Tricky, because we need access to the private implementation, create a new one for
+                                // the test.
+    };
+
+    Policy policy;
+    Tasking::SchedulerUnitTest scheduler;
+};
+
+TEST_F(TestSchedulePolicySharded, HomeShard)
+{
+    EXPECT_TRUE((policy.nextTask() == nullptr));
+    CheckTask task0(scheduler, 3u);
+    CheckTask task1(scheduler, 4u);
+    CheckTask task2(scheduler, 5u);
+    CheckTask task1b(scheduler, 7u);
+    EXPECT_TRUE(policy.queue(task0.impl));
+    EXPECT_TRUE(policy.queue(task1.impl));
+    EXPECT_TRUE(policy.queue(task2.impl));
+    EXPECT_FALSE(policy.queue(task1b.impl));
+    // Each executor gets first the tasks of its home shard
+    EXPECT_TRUE((policy.nextTaskFor(1u) == &task1.impl));
+    EXPECT_TRUE((policy.nextTaskFor(5u) == &task2.impl));
+    EXPECT_TRUE((policy.nextTaskFor(1u) == &task1b.impl));
+    // ... and scans the other shards when the home shard is empty
+    EXPECT_TRUE((policy.nextTaskFor(1u) == &task0.impl));
+    EXPECT_TRUE((policy.nextTaskFor(1u) == nullptr));
+}
+
+TEST_F(TestSchedulePolicySharded, RoundRobin)
+{
+    CheckTask task0a(scheduler, 3u);
+    CheckTask task0b(scheduler, 6u);
+    CheckTask task2(scheduler, 5u);
+    policy.queue(task0a.impl);
+    policy.queue(task0b.impl);
+    policy.queue(task2.impl);
+    EXPECT_TRUE((policy.nextTask() == &task0a.impl));
+    EXPECT_TRUE((policy.nextTask() == &task2.impl));
+    EXPECT_TRUE((policy.nextTask() == &task0b.impl));
+    EXPECT_TRUE((policy.nextTask() == nullptr));
+}
+
+TEST_F(TestSchedulePolicySharded, ExplicitShard)
+{
+    CheckTask task(scheduler, Policy::Settings(2u), 3u);
+    CheckTask other(scheduler, Policy::Settings(Policy::anyShard), 3u);
+    policy.queue(task.impl);
+    policy.queue(other.impl);
+    EXPECT_TRUE((policy.nextTaskFor(2u) == &task.impl));
+    EXPECT_TRUE((policy.nextTaskFor(2u) == &other.impl));
+}
+
+TEST_F(TestSchedulePolicySharded, ShardByGroup)
+{
+    Tasking::GroupProvider<2u> groups[2];
+    CheckTask task1(scheduler, 1u);
+    CheckTask task2(scheduler, 2u);
+    // Without group the shard is selected by the task identification
+    EXPECT_EQ(Tasking::SchedulePolicySharded::shardByTaskId(task1.impl),
+              Tasking::SchedulePolicySharded::shardByGroup(task1.impl));
+    // Only the address of the group is used, so the test implementations can point to the group provider
+    task1.impl.group = reinterpret_cast<Tasking::GroupImpl*>(groups);
+    task2.impl.group = reinterpret_cast<Tasking::GroupImpl*>(groups);
+    EXPECT_EQ(Tasking::SchedulePolicySharded::shardByGroup(task1.impl),
+              Tasking::SchedulePolicySharded::shardByGroup(task2.impl));
+    task2.impl.group = reinterpret_cast<Tasking::GroupImpl*>(groups + 1);
+    EXPECT_NE(Tasking::SchedulePolicySharded::shardByGroup(task1.impl),
+              Tasking::SchedulePolicySharded::shardByGroup(task2.impl));
+}
+
+TEST_F(TestSchedulePolicySharded, InnerSettings)
+{
+    typedef Tasking::SchedulePolicyShardedProvider<Tasking::SchedulePolicyPSlotProvider<2u>, 2u> PSlotPolicy;
+    PSlotPolicy prioritized;
+    Tasking::SchedulerUnitTest prioritizedScheduler(prioritized);
+    PSlotPolicy::ManagementData low(PSlotPolicy::Settings(1u, Tasking::SchedulePolicyPSlot::Settings(0u)));
+    PSlotPolicy::ManagementData high(PSlotPolicy::Settings(1u, Tasking::SchedulePolicyPSlot::Settings(1u)));
+    EXPECT_EQ(0u, low.priority);
+    EXPECT_EQ(1u, high.priority);
+    EXPECT_EQ(1u, high.shard);
+}
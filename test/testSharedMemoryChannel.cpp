@@ -0,0 +1,221 @@
+/*
+ * testSharedMemoryChannel.cpp
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The shared memory channel is only available for the linux platform
+#ifndef IS_NONE_PLATFORM
+
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <reactor.h>
+#include <schedulePolicyFifo.h>
+#include <schedulerUnitTest.h>
+#include <sharedMemoryChannel.h>
+#include <task.h>
+
+class TestSharedMemoryChannel : public ::testing::Test
+{
+public:
+    /// Element with several values, which is sent without serialization
+    struct Sample
+    {
+        uint32_t counter;
+        double value;
+    };
+
+    typedef Tasking::SharedMemoryReceiver<Sample, 8u> Receiver;
+    typedef Tasking::SharedMemorySender<Sample, 8u> Sender;
+
+    /// Task popping all available samples from the channel
+    class ReceiveTask : public Tasking::TaskProvider<1u, Tasking::SchedulePolicyFifo>
+    {
+    public:
+        ReceiveTask(Tasking::Scheduler& scheduler) :
+            TaskProvider(scheduler), executions(0u), received(0u), inOrder(true)
+        {
+            inputs[0].configure(1u);
+        }
+
+        void
+        execute(void) override
+        {
+            Receiver* channel = getChannel<Receiver>(0u);
+            executions++;
+            Sample sample;
+            while (channel->pop(sample))
+            {
+                inOrder = inOrder && (sample.counter == received) && (sample.value == 0.5 * received);
+                received++;
+            }
+        }
+
+        unsigned int executions;
+        unsigned int received;
+        bool inOrder;
+    };
+
+    TestSharedMemoryChannel(void) : scheduler(policy), task(scheduler)
+    {
+    }
+
+    /// Schedule until the task received a number of samples or the timeout in milliseconds is over.
+    void
+    scheduleUntil(unsigned int samples, unsigned int timeout = 1000u)
+    {
+        struct timespec sleepTime = {0, 1000000};
+        for (unsigned int i = 0u; (i < timeout) && (task.received < samples); ++i)
+        {
+            nanosleep(&sleepTime, nullptr);
+            scheduler.schedule();
+        }
+    }
+
+    /// Send a number of samples in place and retry while the ring is full.
+    static void
+    sendSamples(Sender& sender, unsigned int numberOfSamples)
+    {
+        struct timespec sleepTime = {0, 100000};
+        for (unsigned int i = 0u; i < numberOfSamples; ++i)
+        {
+            Sample* sample = sender.allocate();
+            while (sample == nullptr)
+            {
+                nanosleep(&sleepTime, nullptr);
+                sample = sender.allocate();
+            }
+            sample->counter = i;
+            sample->value = 0.5 * i;
+            sender.publish();
+        }
+    }
+
+    Tasking::SchedulePolicyFifo policy;
+    Tasking::SchedulerUnitTest scheduler;
+    Tasking::Reactor reactor;
+    ReceiveTask task;
+};
+
+TEST_F(TestSharedMemoryChannel, SendActivatesTask)
+{
+    Receiver receiver(reactor, 17u);
+    ASSERT_TRUE(receiver.isValid());
+    EXPECT_EQ(17u, receiver.getChannelId());
+    Sender sender(receiver.getMemoryFd(), receiver.getDoorbellFd());
+    ASSERT_TRUE(sender.isValid());
+    task.configureInput(0u, receiver);
+    scheduler.start();
+    EXPECT_TRUE(receiver.arm());
+
+    Sample sample = {0u, 0.0};
+    EXPECT_TRUE(sender.push(sample));
+    scheduleUntil(1u);
+    EXPECT_EQ(1u, task.executions);
+    EXPECT_EQ(1u, task.received);
+
+    // The channel is armed again after the task is finalized
+    sample.counter = 1u;
+    sample.value = 0.5;
+    EXPECT_TRUE(sender.push(sample));
+    scheduleUntil(2u);
+    EXPECT_EQ(2u, task.executions);
+    EXPECT_EQ(2u, task.received);
+    EXPECT_TRUE(task.inOrder);
+    EXPECT_TRUE(receiver.isEmpty());
+}
+
+TEST_F(TestSharedMemoryChannel, FullRingAndInPlaceRead)
+{
+    Sender sender;
+    ASSERT_TRUE(sender.isValid());
+    Receiver receiver(reactor, sender.getMemoryFd(), sender.getDoorbellFd());
+    ASSERT_TRUE(receiver.isValid());
+    sendSamples(sender, 8u);
+    EXPECT_TRUE(nullptr == sender.allocate());
+    const Sample* first = receiver.front();
+    ASSERT_FALSE(nullptr == first);
+    EXPECT_EQ(0u, first->counter);
+    receiver.release();
+    EXPECT_FALSE(nullptr == sender.allocate());
+}
+
+TEST_F(TestSharedMemoryChannel, DoorbellRingsOncePerWait)
+{
+    Sender sender;
+    ASSERT_TRUE(sender.isValid());
+    Receiver receiver(reactor, sender.getMemoryFd(), sender.getDoorbellFd());
+    ASSERT_TRUE(receiver.isValid());
+
+    // Only the first sample rings the doorbell of the waiting receiver
+    sendSamples(sender, 3u);
+    uint64_t rings = 0u;
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(rings)), read(sender.getDoorbellFd(), &rings, sizeof(rings)));
+    EXPECT_EQ(1u, rings);
+
+    // The receiver waits again after it found the ring empty
+    Sample sample;
+    while (receiver.pop(sample))
+    {
+    }
+    sendSamples(sender, 2u);
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(rings)), read(sender.getDoorbellFd(), &rings, sizeof(rings)));
+    EXPECT_EQ(1u, rings);
+}
+
+TEST_F(TestSharedMemoryChannel, AttachWithOtherLayout)
+{
+    Sender sender;
+    ASSERT_TRUE(sender.isValid());
+    Tasking::SharedMemoryReceiver<Sample, 16u> otherSize(reactor, sender.getMemoryFd(), sender.getDoorbellFd());
+    EXPECT_FALSE(otherSize.isValid());
+    Tasking::SharedMemoryReceiver<uint32_t, 8u> otherType(reactor, sender.getMemoryFd(), sender.getDoorbellFd());
+    EXPECT_FALSE(otherType.isValid());
+    EXPECT_TRUE(nullptr == otherType.front());
+}
+
+TEST_F(TestSharedMemoryChannel, SendFromOtherProcess)
+{
+    static const unsigned int numberOfSamples = 1000u;
+    Receiver receiver(reactor);
+    ASSERT_TRUE(receiver.isValid());
+    task.configureInput(0u, receiver);
+    scheduler.start();
+    EXPECT_TRUE(receiver.arm());
+
+    pid_t child = fork();
+    ASSERT_LE(0, child);
+    if (child == 0)
+    {
+        // The forked process inherits the descriptors of the segment and the doorbell
+        Sender sender(receiver.getMemoryFd(), receiver.getDoorbellFd());
+        if (sender.isValid())
+        {
+            sendSamples(sender, numberOfSamples);
+        }
+        _exit(sender.isValid() ? 0 : 1);
+    }
+    scheduleUntil(numberOfSamples, 5000u);
+    int status = -1;
+    waitpid(child, &status, 0);
+    EXPECT_EQ(0, status);
+    EXPECT_EQ(numberOfSamples, task.received);
+    EXPECT_TRUE(task.inOrder);
+}
+
+#endif
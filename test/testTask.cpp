@@ -220,3 +220,88 @@ TEST_F(TestTask, testTaskName)
     Tasking::convertTaskIdToString(task.getTaskId(), name, 4);
     EXPECT_TRUE((strncmp(name, "_6.", 5) == 0));
 }
+
+/// Task with a single input which logs its execution order and pushes to a list of output channels
+class ChainTask : public Tasking::TaskProvider<1u, Tasking::SchedulePolicyLifo>
+{
+public:
+    ChainTask(Tasking::Scheduler& scheduler, Tasking::Channel& input, char p_name, char* p_log) :
+        TaskProvider(scheduler), name(p_name), log(p_log), outputs{nullptr, nullptr}
+    {
+        inputs[0].configure(1u);
+        configureInput(0u, input);
+    }
+
+    void
+    execute(void) override
+    {
+        log[strlen(log)] = name;
+        for (unsigned int i = 0; (i < 2u) && (outputs[i] != nullptr); ++i)
+        {
+            outputs[i]->push();
+        }
+    }
+
+    char name;
+    char* log;
+    TestTask::CheckChannel* outputs[2];
+};
+
+TEST_F(TestTask, fuseRejected)
+{
+    TestTask::CheckChannel channels[3];
+    char log[8] = {0};
+    ChainTask first(scheduler, channels[0], 'A', log);
+    ChainTask second(scheduler, channels[1], 'B', log);
+    ChainTask third(scheduler, channels[2], 'C', log);
+    Tasking::SchedulePolicyLifo otherPolicy;
+    Tasking::SchedulerUnitTest otherScheduler(otherPolicy);
+    ChainTask foreign(otherScheduler, channels[2], 'F', log);
+
+    EXPECT_FALSE(first.fuse(first));
+    EXPECT_FALSE(first.fuse(checker)); // Two inputs
+    EXPECT_FALSE(first.fuse(foreign)); // Other scheduler
+    EXPECT_TRUE(first.fuse(second));
+    EXPECT_FALSE(first.fuse(third));  // Successor already set
+    EXPECT_FALSE(third.fuse(second)); // Predecessor already set
+    EXPECT_TRUE(second.fuse(third));
+    EXPECT_FALSE(third.fuse(first)); // Cycle
+}
+
+TEST_F(TestTask, fusedChain)
+{
+    TestTask::CheckChannel channels[4];
+    char log[8] = {0};
+    ChainTask first(scheduler, channels[0], 'A', log);
+    ChainTask second(scheduler, channels[1], 'B', log);
+    ChainTask third(scheduler, channels[2], 'C', log);
+    ChainTask other(scheduler, channels[3], 'D', log);
+    first.outputs[0] = &channels[1];
+    first.outputs[1] = &channels[3];
+    second.outputs[0] = &channels[2];
+    scheduler.start();
+
+    // Without fusion the last activated task is executed first by the LIFO policy
+    channels[0].push();
+    scheduler.schedule();
+    EXPECT_STREQ("ADBC", log);
+
+    // With fusion the chain is executed back to back
+    memset(log, 0, sizeof(log));
+    EXPECT_TRUE(first.fuse(second));
+    EXPECT_TRUE(second.fuse(third));
+    channels[0].push();
+    scheduler.schedule();
+    EXPECT_STREQ("ABCD", log);
+    // Every task of the chain is reset, once at start and once per execution
+    EXPECT_EQ(3, channels[0].resets);
+    EXPECT_EQ(3, channels[1].resets);
+    EXPECT_EQ(3, channels[2].resets);
+
+    // A fused task activated outside of its predecessor is queued as usual
+    memset(log, 0, sizeof(log));
+    channels[2].push();
+    scheduler.schedule();
+    EXPECT_STREQ("C", log);
+    EXPECT_EQ(4, channels[2].resets);
+}
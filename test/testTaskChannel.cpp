@@ -19,6 +19,10 @@
 #include <gtest/gtest.h>
 #include <taskInput.h>
 #include <taskChannel.h>
+#include <task.h>
+#include <taskInputArray.h>
+#include <schedulerUnitTest.h>
+#include <schedulePolicyLifo.h>
 
 class TestTaskChannel : public ::testing::Test
 {
@@ -38,6 +42,8 @@ public:
         using Tasking::Channel::associateTo;
         using Tasking::Channel::deassociate;
         using Tasking::Channel::push;
+        using Tasking::Channel::pushBatch;
+        using Tasking::Channel::freeze;
     };
 };
 
@@ -120,3 +126,98 @@ TEST_F(TestTaskChannel, testWrongfulAssociation)
     EXPECT_TRUE(input.associate(channel));
     EXPECT_FALSE(input.associate(channel));
 }
+
+TEST_F(TestTaskChannel, frozenFanOut)
+{
+    Tasking::ChannelFanOutProvider<4u> fanOut;
+    IDChannel channel;
+    channel.setFanOut(fanOut);
+    Tasking::Input inputs[3];
+    for (unsigned int i = 0u; i < 3u; ++i)
+    {
+        inputs[i].associate(channel);
+    }
+    channel.push();
+    EXPECT_TRUE(channel.freeze());
+    EXPECT_EQ(3u, fanOut.getNumberOfInputs());
+    // The states are moved with their notifications into the fan-out
+    channel.push();
+    channel.pushBatch(2u);
+    for (unsigned int i = 0u; i < 3u; ++i)
+    {
+        EXPECT_EQ(4u, inputs[i].getNotifications());
+    }
+    // A change of the associated inputs thaws the states
+    inputs[1].deassociate();
+    EXPECT_EQ(0u, fanOut.getNumberOfInputs());
+    channel.push();
+    EXPECT_EQ(5u, inputs[0].getNotifications());
+    EXPECT_EQ(4u, inputs[1].getNotifications());
+    EXPECT_EQ(5u, inputs[2].getNotifications());
+    EXPECT_TRUE(channel.freeze());
+    EXPECT_EQ(2u, fanOut.getNumberOfInputs());
+}
+
+TEST_F(TestTaskChannel, fanOutTooSmall)
+{
+    Tasking::ChannelFanOutProvider<2u> fanOut;
+    IDChannel channel;
+    channel.setFanOut(fanOut);
+    Tasking::Input inputs[3];
+    for (unsigned int i = 0u; i < 3u; ++i)
+    {
+        inputs[i].associate(channel);
+    }
+    EXPECT_FALSE(channel.freeze());
+    EXPECT_EQ(0u, fanOut.getNumberOfInputs());
+    channel.push();
+    for (unsigned int i = 0u; i < 3u; ++i)
+    {
+        EXPECT_EQ(1u, inputs[i].getNotifications());
+    }
+}
+
+TEST_F(TestTaskChannel, schedulerFreezesFanOut)
+{
+    class FanOutTask : public Tasking::TaskProvider<1u, Tasking::SchedulePolicyLifo>
+    {
+    public:
+        FanOutTask(Tasking::Scheduler& scheduler, Tasking::Channel& p_channel) :
+            TaskProvider(scheduler), channel(p_channel), executions(0u)
+        {
+            inputs[0].configure(1u);
+        }
+        void
+        initialize(void) override
+        {
+            configureInput(0u, channel);
+        }
+        void
+        execute(void) override
+        {
+            ++executions;
+        }
+        Tasking::Channel& channel;
+        unsigned int executions;
+    };
+
+    Tasking::SchedulePolicyLifo policy;
+    Tasking::SchedulerUnitTest scheduler(policy);
+    Tasking::ChannelFanOutProvider<2u> fanOut;
+    IDChannel channel;
+    channel.setFanOut(fanOut);
+    FanOutTask task1(scheduler, channel);
+    FanOutTask task2(scheduler, channel);
+
+    scheduler.initialize();
+    EXPECT_EQ(2u, fanOut.getNumberOfInputs());
+    scheduler.start();
+    channel.push();
+    scheduler.schedule();
+    EXPECT_EQ(1u, task1.executions);
+    EXPECT_EQ(1u, task2.executions);
+    channel.push();
+    scheduler.schedule();
+    EXPECT_EQ(2u, task1.executions);
+    EXPECT_EQ(2u, task2.executions);
+}
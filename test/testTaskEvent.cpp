@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 #include <taskEvent.h>
+#include <taskPeriodicSchedule.h>
 #include <task.h>
 #include <schedulerUnitTest.h>
 #include <schedulePolicyLifo.h>
@@ -30,7 +31,8 @@ public:
     {
     public:
         unsigned int counter;
-        CountTask(Tasking::Scheduler& scheduler) : TaskProvider(scheduler), counter(0u)
+        unsigned int missedPeriods;
+        CountTask(Tasking::Scheduler& scheduler) : TaskProvider(scheduler), counter(0u), missedPeriods(0u)
         {
             inputs[0].configure(1u, true);
             inputs[0].setSynchron(false);
@@ -41,6 +43,7 @@ public:
         execute(void)
         {
             counter++;
+            missedPeriods = getChannel<Tasking::Event>(0u)->getMissedPeriods();
         }
     };
 
@@ -49,17 +52,18 @@ public:
     {
     public:
         ControlledEvent(Tasking::Scheduler& scheduler) :
-            Event(scheduler), onFireCounter(0u), shallFireCounter(0u), allowFire(true)
+            Event(scheduler), onFireCounter(0u), shallFireCounter(0u), missedPeriods(0u), allowFire(true)
         {
         }
         ControlledEvent(Tasking::Scheduler& scheduler, const char* name) :
-            Event(scheduler, name), onFireCounter(0u), shallFireCounter(0u), allowFire(true)
+            Event(scheduler, name), onFireCounter(0u), shallFireCounter(0u), missedPeriods(0u), allowFire(true)
         {
         }
         void
         onFire(void) override
         {
             ++onFireCounter;
+            missedPeriods = getMissedPeriods();
         }
         bool
         shallFire(void) override
@@ -69,6 +73,7 @@ public:
         }
         unsigned int onFireCounter;
         unsigned int shallFireCounter;
+        unsigned int missedPeriods;
         bool allowFire;
     };
 
@@ -357,3 +362,118 @@ TEST_F(TestTaskEvent, configureRelativeOnQueuedEvent)
     scheduler.schedule(1u);
     EXPECT_EQ(1u, task.counter);
 }
+
+TEST_F(TestTaskEvent, restartPostponesTimeOut)
+{
+    event.restart(10u); // Time out at 10 ms
+    scheduler.schedule(5u);
+    event.restart(10u); // Postpone time out to 15 ms
+    scheduler.schedule(5u);
+    // Old queue entry is due, but the event is queued again instead to fire
+    EXPECT_EQ(0u, event.onFireCounter);
+    EXPECT_TRUE(event.isTriggered());
+    scheduler.schedule(4u);
+    EXPECT_EQ(0u, task.counter);
+    scheduler.schedule(1u);
+    EXPECT_EQ(1u, task.counter);
+    EXPECT_EQ(1u, event.onFireCounter);
+    EXPECT_FALSE(event.isTriggered());
+    scheduler.schedule(10u);
+    EXPECT_EQ(1u, task.counter);
+}
+
+TEST_F(TestTaskEvent, restartToEarlierTime)
+{
+    event.restart(10u);
+    event.restart(3u); // Earlier time out is queued again
+    scheduler.schedule(3u);
+    EXPECT_EQ(1u, task.counter);
+    scheduler.schedule(7u);
+    EXPECT_EQ(1u, task.counter);
+}
+
+TEST_F(TestTaskEvent, stopRestartedEvent)
+{
+    event.restart(2u);
+    event.restart(4u);
+    event.stop();
+    scheduler.schedule(2u);
+    scheduler.schedule(2u);
+    EXPECT_EQ(0u, task.counter);
+    // After a stop the postponed time is forgotten
+    event.restart(2u);
+    scheduler.schedule(2u);
+    EXPECT_EQ(1u, task.counter);
+}
+
+TEST_F(TestTaskEvent, overrunCatchUp)
+{
+    // Period of 10 ms, handled first at 35 ms. The periods at 20 ms and 30 ms are fired immediately.
+    event.setPeriodicTiming(10u, 10u);
+    scheduler.schedule(35u);
+    EXPECT_EQ(3u, event.onFireCounter);
+    EXPECT_EQ(0u, event.getSkippedPeriods());
+    EXPECT_EQ(0u, event.getMissedPeriods());
+    scheduler.schedule(5u);
+    EXPECT_EQ(4u, event.onFireCounter);
+}
+
+TEST_F(TestTaskEvent, overrunSkip)
+{
+    event.setOverrunPolicy(Tasking::skipOverrun);
+    event.setPeriodicTiming(10u, 10u);
+    scheduler.schedule(35u);
+    // Only the late firing of 10 ms, the periods at 20 ms and 30 ms are skipped
+    EXPECT_EQ(1u, event.onFireCounter);
+    EXPECT_EQ(2u, event.getSkippedPeriods());
+    EXPECT_EQ(0u, event.getMissedPeriods());
+    // Next period in the future is at 40 ms
+    scheduler.schedule(4u);
+    EXPECT_EQ(1u, event.onFireCounter);
+    scheduler.schedule(1u);
+    EXPECT_EQ(2u, event.onFireCounter);
+    EXPECT_EQ(2u, event.getSkippedPeriods());
+}
+
+TEST_F(TestTaskEvent, overrunCoalesce)
+{
+    event.setOverrunPolicy(Tasking::coalesceOverrun);
+    event.setPeriodicTiming(10u, 10u);
+    scheduler.schedule(40u);
+    // The late firing of 10 ms stands also for 20 ms, 30 ms, and the period at 40 ms which is due now
+    EXPECT_EQ(1u, event.onFireCounter);
+    EXPECT_EQ(3u, event.missedPeriods);
+    EXPECT_EQ(1u, task.counter);
+    EXPECT_EQ(3u, task.missedPeriods);
+    EXPECT_EQ(3u, event.getSkippedPeriods());
+    // Next period is at 50 ms, handled at 65 ms the period at 60 ms is coalesced
+    scheduler.schedule(25u);
+    EXPECT_EQ(2u, event.onFireCounter);
+    EXPECT_EQ(1u, event.missedPeriods);
+    EXPECT_EQ(2u, task.counter);
+    EXPECT_EQ(1u, task.missedPeriods);
+    EXPECT_EQ(4u, event.getSkippedPeriods());
+    // A firing on time has no missed periods
+    scheduler.schedule(5u);
+    EXPECT_EQ(3u, event.onFireCounter);
+    EXPECT_EQ(0u, event.missedPeriods);
+    EXPECT_EQ(0u, task.missedPeriods);
+}
+
+TEST_F(TestTaskEvent, overrunSkipWithPeriodicSchedule)
+{
+    Tasking::PeriodicSchedule schedule;
+    Tasking::PeriodicScheduleTrigger trigger2(2u);
+    Tasking::PeriodicScheduleTrigger trigger5(5u);
+    schedule.add(trigger2);
+    schedule.add(trigger5);
+    event.setOverrunPolicy(Tasking::skipOverrun);
+    event.setPeriodicSchedule(10u, 0u, schedule);
+    // Handled at 16 ms, the trigger at 2 ms is pushed late and the triggers at 5, 12, and 15 ms are skipped
+    scheduler.schedule(16u);
+    EXPECT_EQ(3u, event.getSkippedPeriods());
+    // Next trigger at 22 ms is on time
+    scheduler.schedule(6u);
+    EXPECT_EQ(3u, event.getSkippedPeriods());
+    EXPECT_TRUE(event.isTriggered());
+}
@@ -34,6 +34,7 @@ public:
             // Nothing else to do.
         }
         using Tasking::Channel::push;
+        using Tasking::Channel::pushBatch;
     };
 
     /// Receiving task which count the executions
@@ -193,3 +194,33 @@ TEST_F(TestTaskInput, getChannel)
     TestChannel* requestedChannel = input.getChannel<TestChannel>();
     EXPECT_TRUE(requestedChannel == &channel);
 }
+
+TEST_F(TestTaskInput, batchPushSynchronized)
+{
+    input.configure(channel, 2u);
+    // A batch counts like the same number of single pushes
+    channel.pushBatch(1u);
+    EXPECT_FALSE(input.isActivated());
+    channel.pushBatch(4u);
+    EXPECT_TRUE(input.isActivated());
+    EXPECT_EQ(2u, input.getNotifications());
+    EXPECT_EQ(3u, input.getPendingNotifications());
+    channel.pushBatch(2u);
+    EXPECT_EQ(5u, input.getPendingNotifications());
+    input.reset();
+    EXPECT_TRUE(input.isActivated());
+    EXPECT_EQ(3u, input.getPendingNotifications());
+    // An empty batch does not notify
+    channel.pushBatch(0u);
+    EXPECT_EQ(3u, input.getPendingNotifications());
+}
+
+TEST_F(TestTaskInput, batchPushAsynchronous)
+{
+    input.setSynchron(false);
+    channel.pushBatch(3u);
+    EXPECT_EQ(3u, input.getNotifications());
+    EXPECT_EQ(0u, input.getPendingNotifications());
+    channel.pushBatch(0u);
+    EXPECT_EQ(3u, input.getNotifications());
+}
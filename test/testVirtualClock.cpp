@@ -0,0 +1,105 @@
+/*
+ * testVirtualClock.cpp
+ *
+ * Copyright 2012-2020 German Aerospace Center (DLR) SC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The virtual clock is only available for the linux platform build with linuxClock = virtual
+#ifdef TASKING_VIRTUAL_CLOCK
+
+#include <gtest/gtest.h>
+
+#include <schedulePolicyFifo.h>
+#include <schedulerProvider.h>
+#include <task.h>
+#include <taskEvent.h>
+
+class TestVirtualClock : public ::testing::Test
+{
+public:
+    class OutputChannel : public Tasking::Channel
+    {
+    public:
+        using Tasking::Channel::push;
+    };
+
+    // Count task with one input configured with one notification, which forwards its activation to a channel.
+    class CountTask : public Tasking::TaskProvider<1u, Tasking::SchedulePolicyFifo>
+    {
+    public:
+        unsigned int counter;
+        OutputChannel output;
+        CountTask(Tasking::Scheduler& scheduler) : TaskProvider(scheduler), counter(0u)
+        {
+            inputs[0].configure(1u);
+        }
+        void
+        execute(void) override
+        {
+            counter++;
+            output.push();
+        }
+    };
+
+    Tasking::SchedulerProvider<2u, Tasking::SchedulePolicyFifo> scheduler;
+    Tasking::Event event;
+    CountTask first;
+    CountTask second;
+
+    TestVirtualClock(void) : event(scheduler), first(scheduler), second(scheduler)
+    {
+        first.configureInput(0u, event);
+        second.configureInput(0u, first.output);
+    }
+
+    ~TestVirtualClock(void)
+    {
+        scheduler.terminate();
+    }
+};
+
+TEST_F(TestVirtualClock, timeStandsUntilRun)
+{
+    event.setPeriodicTiming(Tasking::fromSeconds(1u), Tasking::fromSeconds(1u));
+    scheduler.start();
+    EXPECT_EQ(0u, scheduler.getTime());
+    EXPECT_EQ(0u, first.counter);
+}
+
+TEST_F(TestVirtualClock, runHourOfPeriodicEvents)
+{
+    event.setPeriodicTiming(Tasking::fromSeconds(1u), Tasking::fromSeconds(1u));
+    scheduler.start();
+
+    // One hour of virtual time with real executors
+    scheduler.runUntil(Tasking::fromSeconds(3600u));
+    EXPECT_EQ(Tasking::fromSeconds(3600u), scheduler.getTime());
+    EXPECT_EQ(3600u, first.counter);
+    EXPECT_EQ(3600u, second.counter);
+
+    // Continue with the next half hour
+    scheduler.runUntil(Tasking::fromSeconds(5400u));
+    EXPECT_EQ(5400u, first.counter);
+    EXPECT_EQ(5400u, second.counter);
+}
+
+TEST_F(TestVirtualClock, advanceToHorizonWithoutEvents)
+{
+    scheduler.start();
+    scheduler.runUntil(Tasking::fromSeconds(10u));
+    EXPECT_EQ(Tasking::fromSeconds(10u), scheduler.getTime());
+}
+
+#endif